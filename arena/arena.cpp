@@ -0,0 +1,171 @@
+//plays many headless matches between two policies in parallel and reports the win rates, the match lengths and the time the decisions took,
+//e.g. to check how a change to the unit definitions affects the balance
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <core/match.hpp>
+#include <core/threadPool.hpp>
+#include <arena/policy.hpp>
+#include <arena/arenaReport.hpp>
+
+struct ArenaSettings
+{
+    std::size_t matches {100};
+    std::size_t threads {ThreadPool::defaultThreadCount()};
+    std::uint64_t seed {1};
+    std::array<std::string, 2> policies {"greedy", "random"};
+    int maxTurns {200};//the match is a draw after this many turns
+    PolicySettings policySettings;
+    bool json {};
+    CsvTables table {CsvTables::policies};//the JSON output has every table
+    std::string output;//the standard output when empty
+};
+
+static void printUsage()
+{
+    std::cerr << "usage: naval-conquest-arena [options]\n"
+        "  --policies ONE,TWO        the policies to play against each other (default greedy,random)\n"
+        "  --matches N               the number of matches (default 100)\n"
+        "  --threads N               the number of matches played at once (default one per core)\n"
+        "  --seed N                  the seed of the first match. Match i is seeded with seed + i (default 1)\n"
+        "  --max-turns N             the turns after which a match is a draw (default 200)\n"
+        "  --search-ms N             the time the search policy has for a decision (default 100)\n"
+        "  --search-iterations N     the iterations of the search policy instead of the time, which makes the matches reproducible\n"
+        "  --format csv|json         (default csv)\n"
+        "  --table NAME              the table of the CSV output: summary, policies, turns, latencies or matches (default policies)\n"
+        "  --output FILE             (default the standard output)\n"
+        "policies:";
+    for(auto name : getPolicyNames()) std::cerr << ' ' << name;
+    std::cerr << '\n';
+}
+static bool parseArguments(int argc, char* argv[], ArenaSettings& settings)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string_view argument = argv[i];
+        if(i + 1 >= argc) return false;//every option has a value
+        std::string value = argv[++i];
+        auto toNumber = [&value]() {return std::strtoull(value.c_str(), nullptr, 10);};
+        if(argument == "--policies")
+        {
+            auto comma = value.find(',');
+            if(comma == std::string::npos) return false;
+            settings.policies = {value.substr(0, comma), value.substr(comma + 1)};
+        }
+        else if(argument == "--matches") settings.matches = toNumber();
+        else if(argument == "--threads") settings.threads = std::max<std::size_t>(toNumber(), 1);
+        else if(argument == "--seed") settings.seed = toNumber();
+        else if(argument == "--max-turns") settings.maxTurns = static_cast<int>(toNumber());
+        else if(argument == "--search-ms") settings.policySettings.searchTime = std::chrono::milliseconds(toNumber());
+        else if(argument == "--search-iterations") settings.policySettings.searchIterations = toNumber();
+        else if(argument == "--format")
+        {
+            if(value != "csv" && value != "json") return false;
+            settings.json = value == "json";
+        }
+        else if(argument == "--table")
+        {
+            auto name = std::find(CSV_TABLE_NAMES.begin(), CSV_TABLE_NAMES.end(), value);
+            if(name == CSV_TABLE_NAMES.end()) return false;
+            settings.table = static_cast<CsvTables>(name - CSV_TABLE_NAMES.begin());
+        }
+        else if(argument == "--output") settings.output = value;
+        else return false;
+    }
+    return true;
+}
+
+//everything the match depends on comes from the seed, so it can be played again with the same seed
+static MatchResult playMatch(const ArenaSettings& settings, std::uint64_t seed)
+{
+    MatchResult returnValue {.seed = seed, .policyOneIsPlayerOne = seed % 2 == 0};
+    std::array<std::unique_ptr<Policy>, 2> policies;
+    for(std::size_t i {}; i < 2; ++i) policies[i] = createPolicy(settings.policies[i], settings.policySettings, RandomStream(seed, i + 1).next());
+
+    Match match(nullptr, seed);
+    //every decision but ending the turn uses up something, so this is only a safeguard against a policy that never ends its turn
+    static constexpr int MAX_DECISIONS_PER_TURN = 100;
+    int turnDecisions {};
+    while(!match.isGameOver() && match.getTurnNumber() < settings.maxTurns)
+    {
+        std::size_t policyIndex = match.isPlayerOneToPlay() == returnValue.policyOneIsPlayerOne ? 0 : 1;
+        auto start = std::chrono::steady_clock::now();
+        Decision decision = policies[policyIndex]->decide(match);
+        returnValue.latencies[policyIndex].add(std::chrono::steady_clock::now() - start);
+        ++returnValue.decisions;
+        if(++turnDecisions > MAX_DECISIONS_PER_TURN) decision = {true};
+        if(!match.apply(decision).used) match.apply({true});
+        if(decision.endTurn) turnDecisions = 0;
+    }
+    returnValue.turns = match.getTurnNumber();
+    if(match.isGameOver())
+    {
+        //the winner is the one whose base is left
+        const GameGrid& grid = match.getGameGrid();
+        bool playerOneWins = (grid.getTeamMask(Team::playerOne) & grid.getLargeMask()).any();
+        returnValue.winner = playerOneWins == returnValue.policyOneIsPlayerOne ? 0 : 1;
+    }
+    return returnValue;
+}
+
+int main(int argc, char* argv[])
+{
+    ArenaSettings settings;
+    if(!parseArguments(argc, argv, settings))
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+    for(const auto& policy : settings.policies)
+    {
+        if(createPolicy(policy, settings.policySettings, 0)) continue;
+        std::cerr << "unknown policy '" << policy << "'\n";
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    ArenaReport report {.policyNames = settings.policies, .maxTurns = settings.maxTurns};
+    report.matches.resize(settings.matches);
+    auto start = std::chrono::steady_clock::now();
+    {
+        //one task per match. The pool's workers steal from each other, so the long matches don't leave cores idle
+        ThreadPool pool(settings.threads);
+        std::vector<std::future<void>> matches;
+        matches.reserve(settings.matches);
+        for(std::size_t i {}; i < settings.matches; ++i)
+        {
+            matches.push_back(pool.submit([&settings, &report, i]()
+            {
+                report.matches[i] = playMatch(settings, settings.seed + i);
+            }));
+        }
+        for(auto& match : matches) match.get();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cerr << settings.matches << " matches in " << elapsed.count() << " s on " << settings.threads << " threads\n";
+
+    std::ofstream file;
+    if(!settings.output.empty())
+    {
+        file.open(settings.output);
+        if(!file)
+        {
+            std::cerr << "unable to open '" << settings.output << "'\n";
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& stream = settings.output.empty() ? std::cout : file;
+    if(settings.json) report.writeJson(stream);
+    else report.writeCsv(stream, settings.table);
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+
+#include <arena/arenaReport.hpp>
+
+void LatencyHistogram::add(std::chrono::nanoseconds latency)
+{
+    auto microseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    ++buckets[std::min<std::size_t>(std::bit_width(microseconds), BUCKET_COUNT - 1)];
+    ++decisions;
+    total += latency;
+    max = std::max(max, latency);
+}
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for(std::size_t i {}; i < BUCKET_COUNT; ++i) buckets[i] += other.buckets[i];
+    decisions += other.decisions;
+    total += other.total;
+    max = std::max(max, other.max);
+}
+std::chrono::microseconds LatencyHistogram::getPercentileBound(double percentile) const
+{
+    auto rank = static_cast<std::uint64_t>(percentile * decisions);
+    std::uint64_t counted {};
+    for(std::size_t i {}; i < BUCKET_COUNT; ++i)
+    {
+        counted += buckets[i];
+        if(counted > rank) return std::min(std::chrono::microseconds(std::uint64_t {1} << i), std::chrono::ceil<std::chrono::microseconds>(max));
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(max);
+}
+
+struct PolicySummary
+{
+    std::uint64_t wins {};
+    std::uint64_t winsAsPlayerOne {};
+    std::uint64_t matchesAsPlayerOne {};
+    LatencyHistogram latency;
+};
+struct ArenaSummary
+{
+    std::array<PolicySummary, 2> policies;
+    std::uint64_t draws {};
+    double meanTurns {};
+    int minTurns {};
+    int maxTurns {};
+    static constexpr int TURN_BUCKET_SIZE = 10;
+    std::vector<std::uint64_t> turnBuckets;//the match lengths in buckets of TURN_BUCKET_SIZE turns
+};
+static ArenaSummary summarize(const ArenaReport& report)
+{
+    ArenaSummary returnValue;
+    returnValue.minTurns = report.matches.empty() ? 0 : std::numeric_limits<int>::max();
+    returnValue.turnBuckets.resize(report.maxTurns / ArenaSummary::TURN_BUCKET_SIZE + 1);
+    for(const auto& match : report.matches)
+    {
+        for(std::size_t i {}; i < 2; ++i)
+        {
+            PolicySummary& policy = returnValue.policies[i];
+            bool playerOne = (i == 0) == match.policyOneIsPlayerOne;
+            if(playerOne) ++policy.matchesAsPlayerOne;
+            if(match.winner == static_cast<int>(i))
+            {
+                ++policy.wins;
+                if(playerOne) ++policy.winsAsPlayerOne;
+            }
+            policy.latency.merge(match.latencies[i]);
+        }
+        if(match.winner < 0) ++returnValue.draws;
+        returnValue.meanTurns += match.turns;
+        returnValue.minTurns = std::min(returnValue.minTurns, match.turns);
+        returnValue.maxTurns = std::max(returnValue.maxTurns, match.turns);
+        ++returnValue.turnBuckets[std::min<std::size_t>(match.turns / ArenaSummary::TURN_BUCKET_SIZE, returnValue.turnBuckets.size() - 1)];
+    }
+    if(!report.matches.empty()) returnValue.meanTurns /= report.matches.size();
+    return returnValue;
+}
+static double getRate(std::uint64_t count, std::uint64_t total)
+{
+    return total ? static_cast<double>(count) / total : 0.;
+}
+static double toMicroseconds(std::chrono::nanoseconds duration)
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void ArenaReport::writeCsv(std::ostream& stream, CsvTables table) const
+{
+    ArenaSummary summary = summarize(*this);
+    switch(table)
+    {
+    case CsvTables::summary:
+        stream << "matches,max_turns,draws,draw_rate,mean_turns,min_turns,max_turns_played\n" << matches.size() << ',' << maxTurns << ',' << summary.draws << ','
+            << getRate(summary.draws, matches.size()) << ',' << summary.meanTurns << ',' << summary.minTurns << ',' << summary.maxTurns << '\n';
+        break;
+    case CsvTables::policies:
+        stream << "policy,name,wins,win_rate,matches_as_player_one,wins_as_player_one,decisions,mean_latency_us,p99_latency_up_to_us,max_latency_us\n";
+        for(std::size_t i {}; i < 2; ++i)
+        {
+            const PolicySummary& policy = summary.policies[i];
+            stream << i << ',' << policyNames[i] << ',' << policy.wins << ',' << getRate(policy.wins, matches.size()) << ',' << policy.matchesAsPlayerOne << ','
+                << policy.winsAsPlayerOne << ',' << policy.latency.decisions << ',' << getRate(policy.latency.total.count(), policy.latency.decisions) / 1000. << ','
+                << policy.latency.getPercentileBound(.99).count() << ',' << toMicroseconds(policy.latency.max) << '\n';
+        }
+        break;
+    case CsvTables::turns:
+        stream << "turns_up_to,matches\n";
+        for(std::size_t i {}; i < summary.turnBuckets.size(); ++i)
+            stream << (i + 1) * ArenaSummary::TURN_BUCKET_SIZE << ',' << summary.turnBuckets[i] << '\n';
+        break;
+    case CsvTables::latencies:
+        stream << "policy,latency_up_to_us,decisions\n";
+        for(std::size_t i {}; i < 2; ++i)
+            for(std::size_t bucket {}; bucket < LatencyHistogram::BUCKET_COUNT; ++bucket)
+                if(summary.policies[i].latency.buckets[bucket]) stream << i << ',' << (std::uint64_t {1} << bucket) << ',' << summary.policies[i].latency.buckets[bucket] << '\n';
+        break;
+    case CsvTables::matches:
+        stream << "match,seed,player_one,winner,turns,decisions\n";
+        for(std::size_t i {}; i < matches.size(); ++i)
+        {
+            const MatchResult& match = matches[i];
+            stream << i << ',' << match.seed << ',' << (match.policyOneIsPlayerOne ? 0 : 1) << ',' << match.winner << ',' << match.turns << ',' << match.decisions << '\n';
+        }
+        break;
+    default:
+        assert(false && "Unknown table");
+        break;
+    }
+}
+void ArenaReport::writeJson(std::ostream& stream) const
+{
+    ArenaSummary summary = summarize(*this);
+    stream << "{\n  \"matches\": " << matches.size() << ",\n  \"maxTurns\": " << maxTurns << ",\n  \"draws\": " << summary.draws
+        << ",\n  \"drawRate\": " << getRate(summary.draws, matches.size()) << ",\n  \"policies\": [";
+    for(std::size_t i {}; i < 2; ++i)
+    {
+        const PolicySummary& policy = summary.policies[i];
+        stream << (i ? ",\n" : "\n") << "    {\"name\": \"" << policyNames[i] << "\", \"wins\": " << policy.wins << ", \"winRate\": " << getRate(policy.wins, matches.size())
+            << ", \"matchesAsPlayerOne\": " << policy.matchesAsPlayerOne << ", \"winsAsPlayerOne\": " << policy.winsAsPlayerOne
+            << ",\n      \"latency\": {\"decisions\": " << policy.latency.decisions << ", \"meanUs\": " << getRate(policy.latency.total.count(), policy.latency.decisions) / 1000.
+            << ", \"p99UpToUs\": " << policy.latency.getPercentileBound(.99).count() << ", \"maxUs\": " << toMicroseconds(policy.latency.max) << ", \"histogram\": [";
+        bool first = true;
+        for(std::size_t bucket {}; bucket < LatencyHistogram::BUCKET_COUNT; ++bucket)
+        {
+            if(!policy.latency.buckets[bucket]) continue;
+            stream << (first ? "" : ", ") << "{\"upToUs\": " << (std::uint64_t {1} << bucket) << ", \"decisions\": " << policy.latency.buckets[bucket] << '}';
+            first = false;
+        }
+        stream << "]}}";
+    }
+    stream << "\n  ],\n  \"turns\": {\"mean\": " << summary.meanTurns << ", \"min\": " << summary.minTurns << ", \"max\": " << summary.maxTurns << ", \"histogram\": [";
+    for(std::size_t i {}; i < summary.turnBuckets.size(); ++i)
+        stream << (i ? ", " : "") << "{\"upTo\": " << (i + 1) * ArenaSummary::TURN_BUCKET_SIZE << ", \"matches\": " << summary.turnBuckets[i] << '}';
+    stream << "]},\n  \"results\": [";
+    for(std::size_t i {}; i < matches.size(); ++i)
+    {
+        const MatchResult& match = matches[i];
+        stream << (i ? ",\n" : "\n") << "    {\"seed\": " << match.seed << ", \"playerOne\": " << (match.policyOneIsPlayerOne ? 0 : 1) << ", \"winner\": " << match.winner
+            << ", \"turns\": " << match.turns << ", \"decisions\": " << match.decisions << '}';
+    }
+    stream << "\n  ]\n}\n";
+}
\ No newline at end of file
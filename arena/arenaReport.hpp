@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//the time the decisions took in buckets of powers of two microseconds: bucket 0 is under 1 µs and bucket i from 2^(i-1) to 2^i µs
+struct LatencyHistogram
+{
+    static constexpr std::size_t BUCKET_COUNT = 32;
+    std::array<std::uint64_t, BUCKET_COUNT> buckets {};
+    std::uint64_t decisions {};
+    std::chrono::nanoseconds total {};
+    std::chrono::nanoseconds max {};
+    void add(std::chrono::nanoseconds latency);
+    void merge(const LatencyHistogram& other);
+    std::chrono::microseconds getPercentileBound(double percentile) const;//the upper bound of the percentile's bucket, not the exact latency
+};
+
+struct MatchResult
+{
+    std::uint64_t seed {};
+    bool policyOneIsPlayerOne {};
+    int winner {-1};//the index of the winning policy, or -1 when the turn limit was reached
+    int turns {};
+    std::uint64_t decisions {};
+    std::array<LatencyHistogram, 2> latencies;//indexed by policy
+};
+
+//the CSV output has one table per file, each with its own columns. The JSON output has all of them
+enum class CsvTables : std::uint8_t
+{
+    summary,
+    policies,
+    turns,//the match lengths
+    latencies,//the histogram of the decision times
+    matches,
+    count
+};
+inline constexpr std::size_t CSV_TABLES_COUNT {static_cast<std::size_t>(CsvTables::count)};
+inline constexpr std::array<std::string_view, CSV_TABLES_COUNT> CSV_TABLE_NAMES {"summary", "policies", "turns", "latencies", "matches"};
+
+struct ArenaReport
+{
+    std::array<std::string, 2> policyNames;
+    int maxTurns {};
+    std::vector<MatchResult> matches;
+    void writeCsv(std::ostream& stream, CsvTables table) const;
+    void writeJson(std::ostream& stream) const;
+};
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <array>
+#include <utility>
+
+#include <arena/policy.hpp>
+
+Decision RandomPolicy::decide(const Match& match)
+{
+    match.getLegalDecisions(m_decisions);
+    return m_decisions[m_random.get<std::size_t>(0, m_decisions.size() - 1)];
+}
+
+Decision GreedyPolicy::decide(const Match& match)
+{
+    match.getLegalDecisions(m_decisions);
+    //ending the turn keeps the position, so it's the baseline. The evaluation is for player one
+    const float sign = match.isPlayerOneToPlay() ? 1.f : -1.f;
+    float bestValue = sign * evaluateMatch(match);
+    Decision returnValue {true};
+    for(const auto& decision : m_decisions)
+    {
+        if(decision.endTurn) continue;
+        Match copy = match;
+        copy.setListener(nullptr);
+        copy.setRandom(RandomStream(m_random.next()));
+        if(!copy.apply(decision).used) continue;
+        float value = sign * evaluateMatch(copy);
+        if(value > bestValue)
+        {
+            bestValue = value;
+            returnValue = decision;
+        }
+    }
+    return returnValue;
+}
+
+SearchPolicy::SearchPolicy(const PolicySettings& settings)
+    : m_player({.timeBudget = settings.searchTime, .iterationBudget = settings.searchIterations, .threadCount = 1,
+        .transpositionTableSizeLog2 = settings.searchTableSizeLog2}) {}
+
+static constexpr std::array<std::string_view, 3> POLICY_NAMES {"random", "greedy", "search"};
+std::span<const std::string_view> getPolicyNames()
+{
+    return POLICY_NAMES;
+}
+std::unique_ptr<Policy> createPolicy(std::string_view name, const PolicySettings& settings, std::uint64_t seed)
+{
+    if(name == "random") return std::make_unique<RandomPolicy>(seed);
+    if(name == "greedy") return std::make_unique<GreedyPolicy>(seed);
+    if(name == "search") return std::make_unique<SearchPolicy>(settings);
+    return nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <core/match.hpp>
+#include <core/mcts.hpp>
+
+struct PolicySettings
+{
+    std::chrono::milliseconds searchTime {100};
+    std::size_t searchIterations {};//reproducible searches when not 0
+    int searchTableSizeLog2 {16};//many matches are played at once, so the tables are smaller than in the game
+};
+
+//chooses the decisions of one side of a headless match
+class Policy
+{
+public:
+    virtual ~Policy() = default;
+    virtual Decision decide(const Match& match) = 0;
+};
+
+//any legal decision with the same probability
+class RandomPolicy : public Policy
+{
+private:
+    std::vector<Decision> m_decisions;
+    RandomStream m_random;
+public:
+    explicit RandomPolicy(std::uint64_t seed) : m_random(seed) {}
+    Decision decide(const Match& match) override;
+};
+
+//the decision that improves the evaluation of the search the most, or ending the turn when none does
+class GreedyPolicy : public Policy
+{
+private:
+    std::vector<Decision> m_decisions;
+    RandomStream m_random;//the damage of the simulated attacks, which would be the real damage with the match's own stream
+public:
+    explicit GreedyPolicy(std::uint64_t seed) : m_random(seed) {}
+    Decision decide(const Match& match) override;
+};
+
+//Monte Carlo tree search on the calling thread. The matches are the unit of parallelism in the arena
+class SearchPolicy : public Policy
+{
+private:
+    MctsPlayer m_player;
+public:
+    explicit SearchPolicy(const PolicySettings& settings);
+    Decision decide(const Match& match) override {return m_player.search(match);}
+};
+
+std::span<const std::string_view> getPolicyNames();
+std::unique_ptr<Policy> createPolicy(std::string_view name, const PolicySettings& settings, std::uint64_t seed);//nullptr when there is no policy with the name
\ No newline at end of file
@@ -3,8 +3,15 @@ out vec4 FragColor;
 
 in vec3 Normal;
 in vec3 FragPos;
+flat in vec3 MaterialColor;
+flat in vec3 MaterialProperties;
 
-uniform vec3 cameraPos;
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    vec3 cameraPos;
+};
 
 struct Material
 {
@@ -13,31 +20,35 @@ struct Material
     float shininess;
     float specularStrength;
 }; 
-uniform Material material;
+Material material;
 
+//the block structs in renderEngine.cpp mirror the std140 offsets of these structs, padding included
 struct PointLight
 {
     vec3 color;
-    vec3 position;
     float strength;
+    vec3 position;
     float linear;
     float quadratic;
 };
-uniform PointLight lights[MAX_POINT_LIGHTS_LENGTH];
-uniform int lightsCount;
-
 struct DirectionalLight 
 {
     vec3 color;
     vec3 direction;
     float strength;
 };
-uniform DirectionalLight directionalLight;
+layout (std140) uniform Lighting
+{
+    DirectionalLight directionalLight;
+    PointLight lights[MAX_POINT_LIGHTS_LENGTH];
+    int lightsCount;
+};
 
 vec3 CalculatePointLight(PointLight pointLight, vec3 normal, vec3 fragPos, vec3 viewDir);
 
 void main()
 {
+    material = Material(MaterialColor, MaterialProperties.x, MaterialProperties.y, MaterialProperties.z);
     vec3 norm = normalize(Normal);
     vec3 viewDir = normalize(cameraPos - FragPos);
 
@@ -1,17 +1,28 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNorm;
+//instance attributes
+layout (location = 2) in mat4 aModel;
+layout (location = 6) in vec3 aColor;
+layout (location = 7) in vec3 aMaterial;
 
 out vec3 FragPos;
 out vec3 Normal;
+flat out vec3 MaterialColor;
+flat out vec3 MaterialProperties;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    vec3 cameraPos;
+};
 
 void main()
 {
-    FragPos = vec3(model * vec4(aPos, 1.f));
-    Normal = mat3(transpose(inverse(model))) * aNorm;
+    FragPos = vec3(aModel * vec4(aPos, 1.f));
+    Normal = mat3(transpose(inverse(aModel))) * aNorm;
+    MaterialColor = aColor;
+    MaterialProperties = aMaterial;
     gl_Position = projection * view * vec4(FragPos, 1.f);
 }
\ No newline at end of file
@@ -4,8 +4,12 @@ layout (location = 1) in vec3 aNorm;
 out vec3 FragPos;
 
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+layout (std140) uniform Camera
+{
+    mat4 view;
+    mat4 projection;
+    vec3 cameraPos;
+};
 uniform float time;
 out float zPosOffset;
 
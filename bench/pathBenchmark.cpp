@@ -0,0 +1,205 @@
+//compares GameGrid::findPath against the previous node-allocating A* on random island layouts
+#include <array>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+#include <core/gameGrid.hpp>
+
+using Loc = GameGrid::Loc;
+
+//the implementation findPath had before the indexed heap, kept here as the baseline
+static GameGrid::Path legacyFindPath(const GameGrid& grid, Loc startLoc, Loc moveLoc)
+{
+    if(startLoc == moveLoc) return {startLoc};
+    struct PathNode
+    {
+        int gCost {std::numeric_limits<int>::max()};
+        int hCost {};
+        int fCost {};
+        Loc loc;
+        PathNode* parentNode {};
+        void calculateFCost() {fCost = hCost + gCost;}
+    };
+    struct ComparePathNodes
+    {
+        bool operator()(const PathNode* lhs, const PathNode* rhs) const
+        {
+            if(lhs->fCost != rhs->fCost) return lhs->fCost < rhs->fCost;
+            return GameGrid::convertLocationToIndex(lhs->loc) < GameGrid::convertLocationToIndex(rhs->loc);
+        }
+    };
+    auto calculateDistanceCost = [](PathNode* pathNode1, PathNode* pathNode2) -> int
+    {
+        int xDistance = std::abs(static_cast<int>(pathNode1->loc.first) - static_cast<int>(pathNode2->loc.first));
+        int yDistance = std::abs(static_cast<int>(pathNode1->loc.second) - static_cast<int>(pathNode2->loc.second));
+        return 14 * std::min(xDistance, yDistance) + 10 * std::abs(xDistance - yDistance);
+    };
+    std::array<std::unique_ptr<PathNode>, GRID_SIZE * GRID_SIZE> nodes;
+    auto initializeNode = [&nodes](Loc loc) -> PathNode*
+    {
+        auto& node = nodes[GameGrid::convertLocationToIndex(loc)];
+        node = std::make_unique<PathNode>();
+        node->calculateFCost();
+        node->loc = loc;
+        return node.get();
+    };
+    PathNode* startNode = initializeNode(startLoc);
+    startNode->gCost = 0;
+    PathNode* endNode = initializeNode(moveLoc);
+    startNode->hCost = calculateDistanceCost(startNode, endNode);
+    startNode->calculateFCost();
+
+    std::set<PathNode*, ComparePathNodes> openList {startNode};
+    std::unordered_set<PathNode*> closedList;
+    const Bitboard obstacles = grid.getOccupied() & ~grid.getObjectMask(startLoc) & ~grid.getObjectMask(moveLoc);
+    while(!openList.empty())
+    {
+        auto currentNode = *openList.begin();
+        if(currentNode == endNode)
+        {
+            GameGrid::Path returnValue;
+            for(; currentNode; currentNode = currentNode->parentNode) returnValue.push_front(currentNode->loc);
+            return returnValue;
+        }
+        openList.erase(currentNode);
+        closedList.insert(currentNode);
+        for(int dx = -1; dx <= 1; ++dx)
+            for(int dy = -1; dy <= 1; ++dy)
+            {
+                int x = static_cast<int>(currentNode->loc.first) + dx, y = static_cast<int>(currentNode->loc.second) + dy;
+                if((!dx && !dy) || x < 0 || x >= GRID_SIZE || y < 0 || y >= GRID_SIZE) continue;
+                Loc neighbourLoc = std::make_pair(x, y);
+                std::size_t index = GameGrid::convertLocationToIndex(neighbourLoc);
+                if(obstacles.test(index)) continue;
+                PathNode* neighbourNode = nodes[index] ? nodes[index].get() : initializeNode(neighbourLoc);
+                if(closedList.contains(neighbourNode)) continue;
+                int tentativeGCost = currentNode->gCost + calculateDistanceCost(currentNode, neighbourNode);
+                if(tentativeGCost < neighbourNode->gCost)
+                {
+                    openList.erase(neighbourNode);
+                    neighbourNode->parentNode = currentNode;
+                    neighbourNode->gCost = tentativeGCost;
+                    neighbourNode->hCost = calculateDistanceCost(neighbourNode, endNode);
+                    neighbourNode->calculateFCost();
+                    openList.insert(neighbourNode);
+                }
+            }
+    }
+    return {};
+}
+
+//the length of the path in the units A* uses, -1 when there is no path
+template<typename It>
+static int pathCost(It begin, It end)
+{
+    if(begin == end) return -1;
+    int returnValue {};
+    for(auto it = std::next(begin); it != end; ++it)
+        returnValue += it->first != std::prev(it)->first && it->second != std::prev(it)->second ? 14 : 10;
+    return returnValue;
+}
+
+//the same kind of layout Match generates: two bases, seven islands and some units around them
+static void generateLayout(GameGrid& grid, std::mt19937& rng)
+{
+    auto get = [&rng](std::size_t min, std::size_t max) {return std::uniform_int_distribution<std::size_t>(min, max)(rng);};
+    std::size_t baseY = get(2, (GRID_SIZE - 4) / 2) * 2;
+    grid.initializeAt(UnitTypes::base, 0, baseY, Team::playerOne);
+    grid.initializeAt(UnitTypes::base, GRID_SIZE - 2, GRID_SIZE - 2 - baseY, Team::playerTwo);
+
+    std::vector<Loc> islandLocations;
+    for(std::size_t x = 2; x < GRID_SIZE - 2; x += 2)
+        for(std::size_t y {}; y < GRID_SIZE; y += 2) islandLocations.push_back(std::make_pair(x, y));
+    std::shuffle(islandLocations.begin(), islandLocations.end(), rng);
+    for(std::size_t i {}; i < 7; ++i) grid.initializeAt(UnitTypes::island, islandLocations[i]);
+
+    for(std::size_t i = get(0, 24); i; --i)
+    {
+        Loc loc = std::make_pair(get(0, GRID_SIZE - 1), get(0, GRID_SIZE - 1));
+        if(!grid.at(loc)) grid.initializeAt(get(0, 1) ? UnitTypes::ship : UnitTypes::submarine, loc, get(0, 1) ? Team::playerOne : Team::playerTwo);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t layoutCount = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    static constexpr std::size_t QUERIES_PER_LAYOUT = 64;
+
+    std::mt19937 rng {12345};
+    std::vector<GameGrid> grids(layoutCount);
+    std::vector<std::pair<Loc, Loc>> queries;
+    for(auto& grid : grids)
+    {
+        generateLayout(grid, rng);
+        std::uniform_int_distribution<std::size_t> coordinate(0, GRID_SIZE - 1);
+        for(std::size_t i {}; i < QUERIES_PER_LAYOUT; ++i)
+            queries.push_back({std::make_pair(coordinate(rng), coordinate(rng)), std::make_pair(coordinate(rng), coordinate(rng))});
+    }
+
+    //both implementations have to find a path of the same cost
+    std::size_t mismatches {}, found {};
+    for(std::size_t i {}; i < queries.size(); ++i)
+    {
+        const GameGrid& grid = grids[i / QUERIES_PER_LAYOUT];
+        auto [start, target] = queries[i];
+        auto legacyPath = legacyFindPath(grid, start, target);
+        GameGrid::PathBuffer path;
+        std::size_t length = grid.findPath(start, target, path);
+        if(pathCost(legacyPath.begin(), legacyPath.end()) != pathCost(path.begin(), path.begin() + length)) ++mismatches;
+        if(length) ++found;
+    }
+
+    auto measure = [&](auto&& findPath)
+    {
+        std::size_t checksum {};
+        auto start = std::chrono::steady_clock::now();
+        for(std::size_t i {}; i < queries.size(); ++i)
+            checksum += findPath(grids[i / QUERIES_PER_LAYOUT], queries[i].first, queries[i].second);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return std::make_pair(elapsed.count() / queries.size(), checksum);
+    };
+    auto legacy = measure([](const GameGrid& grid, Loc start, Loc target) {return legacyFindPath(grid, start, target).size();});
+    auto current = measure([](const GameGrid& grid, Loc start, Loc target)
+    {
+        GameGrid::PathBuffer path;
+        return grid.findPath(start, target, path);
+    });
+
+    //a move preview asks for the reachability of every cell from the same origin
+    auto measurePreview = [&](auto&& isReachable)
+    {
+        std::size_t checksum {};
+        auto start = std::chrono::steady_clock::now();
+        for(std::size_t i {}; i < queries.size(); i += QUERIES_PER_LAYOUT)
+            for(std::size_t index {}; index < GameGrid::size(); ++index)
+                checksum += isReachable(grids[i / QUERIES_PER_LAYOUT], queries[i].first, GameGrid::convertIndexToLocation(index));
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return std::make_pair(elapsed.count() / layoutCount, checksum);
+    };
+    auto previewAStar = measurePreview([](const GameGrid& grid, Loc start, Loc target)
+    {
+        //no distance field has been computed yet, so every call runs A*
+        GameGrid::PathBuffer path;
+        return grid.findPath(start, target, path, true) != 0;
+    });
+    auto previewDistanceField = measurePreview([](const GameGrid& grid, Loc start, Loc target)
+    {
+        return grid.getDistanceField(start).isReachable(GameGrid::convertLocationToIndex(target));
+    });
+
+    std::cout << queries.size() << " queries on " << layoutCount << " layouts, " << found << " paths found, " << mismatches << " cost mismatches\n";
+    std::cout << "legacy A*:  " << legacy.first << " ns/query\n";
+    std::cout << "current A*: " << current.first << " ns/query (" << legacy.first / current.first << "x)\n";
+    std::cout << "move preview with A*:             " << previewAStar.first << " ns/origin\n";
+    std::cout << "move preview with distance field: " << previewDistanceField.first << " ns/origin (" << previewAStar.first / previewDistanceField.first << "x)\n";
+    return mismatches ? EXIT_FAILURE : EXIT_SUCCESS;
+}
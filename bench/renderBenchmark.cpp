@@ -0,0 +1,121 @@
+//renders a scripted late-game position offscreen and reports the frame timings, so every rendering change gets a number even on machines without a GPU
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <format>
+#include <numbers>
+#include <random>
+#include <chrono>
+#include <string>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <core/gameState.hpp>
+#include <core/match.hpp>
+#include <core/gameGrid.hpp>
+#include <engine/renderEngine.hpp>
+#include <engine/camera.hpp>
+#include <engine/profiler.hpp>
+#include <game/gameController.hpp>
+#include <glfwController.hpp>
+
+static constexpr std::uint64_t SEED {2024};
+static constexpr int WARMUP_FRAMES {10};
+
+//most of the free water is filled with the units of both teams and the bases are fully upgraded
+static GameState createLateGameState()
+{
+    Match match(nullptr, SEED);
+    GameState returnValue = match.getState();
+    static constexpr std::array<UnitTypes, 5> UNITS
+        {UnitTypes::submarine, UnitTypes::submarineUpgrade1, UnitTypes::ship, UnitTypes::aircraftCarrier, UnitTypes::aircraftCarrierUpgrade1};
+    std::mt19937 rng {SEED};
+    for(std::size_t index {}; index < returnValue.cells.size(); ++index)
+    {
+        StateCell& cell = returnValue.cells[index];
+        if(isBase(cell.type))
+        {
+            cell = {UnitTypes::baseUpgrade2, cell.team, static_cast<std::int16_t>(getUnitDefinition(UnitTypes::baseUpgrade2).health)};
+            continue;
+        }
+        if(returnValue.cells[returnValue.getObjectIndex(index)].type != UnitTypes::none || rng() % 4 == 0) continue;
+        UnitTypes type = UNITS[rng() % UNITS.size()];
+        Team team = GameGrid::convertIndexToLocation(index).first < GRID_SIZE / 2 ? Team::playerOne : Team::playerTwo;
+        cell = {type, team, static_cast<std::int16_t>(getUnitDefinition(type).health)};
+    }
+    returnValue.turnNumber = 120;
+    return returnValue;
+}
+
+//one orbit around the grid over the measured frames, so the runs are comparable
+class BenchmarkCamera : public Camera
+{
+private:
+    int m_frame {}, m_frameCount;
+public:
+    BenchmarkCamera(int frameCount) : Camera(glm::vec3(0.f)), m_frameCount(frameCount) {}
+    void update() override
+    {
+        float angle = 2.f * std::numbers::pi_v<float> * m_frame++ / m_frameCount;
+        m_position = glm::vec3(std::cos(angle) * 2.3f, 1.3f, std::sin(angle) * 2.3f);
+        m_view = glm::lookAt(m_position, glm::vec3(0.f), glm::vec3(0.f, 1.f, 0.f));
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    //the statistics are over the last frames the profiler keeps
+    const int frameCount = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(Profiler::HISTORY_LENGTH);
+    const char* tracePath = argc > 2 ? argv[2] : nullptr;
+
+    GLFWController::setHeadless(true);
+    GLFWController& glfwControllerInstance = GLFWController::getInstance();
+    RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    GameController& gameControllerInstance = GameController::getInstance();
+    Profiler& profilerInstance = Profiler::getInstance();
+
+    gameControllerInstance.setStartState(createLateGameState());
+    gameControllerInstance.createGame();
+    BenchmarkCamera camera(frameCount);
+    renderEngineInstance.assignCamera(&camera);
+
+    auto renderFrames = [&](int frames)
+    {
+        for(int frame {}; frame < frames; ++frame)
+        {
+            profilerInstance.beginFrame();
+            renderEngineInstance.update();
+            glFinish();//the frame includes the GPU's work
+        }
+    };
+    renderFrames(WARMUP_FRAMES);
+    if(tracePath) profilerInstance.startTrace();
+    else profilerInstance.setEnabled(true);
+    auto start = std::chrono::steady_clock::now();
+    renderFrames(frameCount);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    unsigned int error = glGetError();
+
+    const RenderStatistics& statistics = renderEngineInstance.getStatistics();
+    std::cout << std::format("{} frames at {}x{}: {:.1f} fps\n", frameCount, glfwControllerInstance.getWidth(), glfwControllerInstance.getHeight(), frameCount / elapsed.count());
+    std::cout << std::format("per frame: {} draws, {} instances, {} shader changes, {} mesh changes, {} depth test changes, {} skipped binds\n",
+        statistics.draws, statistics.instances, statistics.shaderChanges, statistics.meshChanges, statistics.depthTestChanges, statistics.skippedChanges);
+    std::cout << std::format("{:<24}{:>10}{:>10}{:>10}{:>10}\n", "ms", "cpu avg", "cpu p99", "gpu avg", "gpu p99");
+    for(auto section : {ProfileSections::frame, ProfileSections::renderEngine, ProfileSections::normalPass, ProfileSections::noDepthTestPass,
+        ProfileSections::renderLastlyPass, ProfileSections::overlay2DPass, ProfileSections::callbacksPass})
+    {
+        ProfileStatistics cpu = profilerInstance.getStatistics(section), gpu = profilerInstance.getStatistics(section, true);
+        if(!cpu.samples) continue;
+        std::cout << std::format("{:<24}{:>10.3f}{:>10.3f}", PROFILE_SECTION_NAMES[static_cast<std::size_t>(section)], cpu.average, cpu.p99);
+        if(gpu.samples) std::cout << std::format("{:>10.3f}{:>10.3f}", gpu.average, gpu.p99);
+        std::cout << '\n';
+    }
+    if(tracePath && !profilerInstance.writeTrace(tracePath))
+        std::cerr << "unable to write the trace '" << tracePath << "'\n";
+    if(error) std::cerr << "GL error " << error << '\n';
+    return error ? EXIT_FAILURE : EXIT_SUCCESS;
+}
\ No newline at end of file
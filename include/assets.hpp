@@ -7,13 +7,13 @@
 
 namespace assets
 {
-	inline constexpr std::string_view SHADERS_FBASIC_GLSL {"#version 330 core\nout vec4 FragColor;in vec3 Normal;in vec3 FragPos;uniform vec3 cameraPos;struct Material{\nvec3 color;float ambientStrength;float shininess;float specularStrength;};uniform Material material;struct PointLight{\nvec3 color;vec3 position;float strength;float linear;float quadratic;};uniform PointLight lights[MAX_POINT_LIGHTS_LENGTH];uniform int lightsCount;struct DirectionalLight{\nvec3 color;vec3 direction;float strength;};uniform DirectionalLight directionalLight;vec3 CalculatePointLight(PointLight pointLight,vec3 normal,vec3 fragPos,vec3 viewDir);void main(){\nvec3 norm=normalize(Normal);vec3 viewDir=normalize(cameraPos - FragPos);//directional light\nvec3 dirLightColor=directionalLight.color*directionalLight.strength;vec3 directionalAmbient=material.ambientStrength*dirLightColor;vec3 dirLightDir=normalize(-directionalLight.direction);float directDiff=max(dot(norm,dirLightDir),0.f);vec3 directionalDiffuse=directDiff*dirLightColor;vec3 directionalReflectDir=reflect(-dirLightDir,norm);float directionalSpec=pow(max(dot(viewDir,directionalReflectDir),0.f),material.shininess);vec3 directionalSpecular=dirLightColor*directionalSpec*material.specularStrength;vec3 result=directionalAmbient+directionalDiffuse+directionalSpecular;//point lights\nfor(int i=0;i<lightsCount;i++)\nresult+=CalculatePointLight(lights[i],norm,FragPos,viewDir);\nresult*=material.color;FragColor=vec4(result,1.f);}vec3 CalculatePointLight(PointLight pointLight,vec3 normal,vec3 fragPos,vec3 viewDir){\n//ambient\nvec3 ambient=material.ambientStrength*pointLight.color;//diffuse\nvec3 lightDir=normalize(pointLight.position - fragPos);float diff=max(dot(normal,lightDir),0.f);vec3 diffuse=diff*pointLight.color;//specular\nvec3 reflectDir=reflect(-lightDir,normal);float spec=pow(max(dot(viewDir,reflectDir),0.f),material.shininess);vec3 specular=material.specularStrength*spec*pointLight.color;float distance=length(pointLight.position - fragPos);float attenuation=1./(pointLight.strength+pointLight.linear*distance+pointLight.quadratic*(distance*distance));ambient*=attenuation;diffuse*=attenuation;specular*=attenuation;return ambient+diffuse+specular;}\0"};
+	inline constexpr std::string_view SHADERS_FBASIC_GLSL {"#version 330 core\nout vec4 FragColor;in vec3 Normal;in vec3 FragPos;flat in vec3 MaterialColor;flat in vec3 MaterialProperties;layout(std140)uniform Camera{\nmat4 view;mat4 projection;vec3 cameraPos;};struct Material{\nvec3 color;float ambientStrength;float shininess;float specularStrength;};Material material;//the block structs in renderEngine.cpp mirror the std140 offsets of these structs,padding included\nstruct PointLight{\nvec3 color;float strength;vec3 position;float linear;float quadratic;};struct DirectionalLight{\nvec3 color;vec3 direction;float strength;};layout(std140)uniform Lighting{\nDirectionalLight directionalLight;PointLight lights[MAX_POINT_LIGHTS_LENGTH];int lightsCount;};vec3 CalculatePointLight(PointLight pointLight,vec3 normal,vec3 fragPos,vec3 viewDir);void main(){\nmaterial=Material(MaterialColor,MaterialProperties.x,MaterialProperties.y,MaterialProperties.z);vec3 norm=normalize(Normal);vec3 viewDir=normalize(cameraPos - FragPos);//directional light\nvec3 dirLightColor=directionalLight.color*directionalLight.strength;vec3 directionalAmbient=material.ambientStrength*dirLightColor;vec3 dirLightDir=normalize(-directionalLight.direction);float directDiff=max(dot(norm,dirLightDir),0.f);vec3 directionalDiffuse=directDiff*dirLightColor;vec3 directionalReflectDir=reflect(-dirLightDir,norm);float directionalSpec=pow(max(dot(viewDir,directionalReflectDir),0.f),material.shininess);vec3 directionalSpecular=dirLightColor*directionalSpec*material.specularStrength;vec3 result=directionalAmbient+directionalDiffuse+directionalSpecular;//point lights\nfor(int i=0;i<lightsCount;i++)\nresult+=CalculatePointLight(lights[i],norm,FragPos,viewDir);\nresult*=material.color;FragColor=vec4(result,1.f);}vec3 CalculatePointLight(PointLight pointLight,vec3 normal,vec3 fragPos,vec3 viewDir){\n//ambient\nvec3 ambient=material.ambientStrength*pointLight.color;//diffuse\nvec3 lightDir=normalize(pointLight.position - fragPos);float diff=max(dot(normal,lightDir),0.f);vec3 diffuse=diff*pointLight.color;//specular\nvec3 reflectDir=reflect(-lightDir,normal);float spec=pow(max(dot(viewDir,reflectDir),0.f),material.shininess);vec3 specular=material.specularStrength*spec*pointLight.color;float distance=length(pointLight.position - fragPos);float attenuation=1./(pointLight.strength+pointLight.linear*distance+pointLight.quadratic*(distance*distance));ambient*=attenuation;diffuse*=attenuation;specular*=attenuation;return ambient+diffuse+specular;}\0"};
 	inline constexpr std::string_view SHADERS_FSIMPLEUNLIT_GLSL {"#version 330 core\nout vec4 FragColor;uniform vec3 color;void main(){\nFragColor=vec4(color,1.f);}\0"};
 	inline constexpr std::string_view SHADERS_FWATER_GLSL {"#version 330 core\nin vec3 FragPos;out vec4 FragColor;in float zPosOffset;void main(){\nFragColor=vec4(.3f,.4f+cos(zPosOffset/10.f)/10.f,.8f+(0.1f+zPosOffset/10.f),1.f);}\0"};
 	inline constexpr std::string_view SHADERS_V2D_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;uniform mat4 model;void main(){\ngl_Position=model*vec4(aPos,1.);}\0"};
-	inline constexpr std::string_view SHADERS_VBASIC_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;layout(location=1)in vec3 aNorm;out vec3 FragPos;out vec3 Normal;uniform mat4 model;uniform mat4 view;uniform mat4 projection;void main(){\nFragPos=vec3(model*vec4(aPos,1.f));Normal=mat3(transpose(inverse(model)))*aNorm;gl_Position=projection*view*vec4(FragPos,1.f);}\0"};
-	inline constexpr std::string_view SHADERS_VSIMPLE_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;uniform mat4 model;uniform mat4 view;uniform mat4 projection;void main(){\ngl_Position=projection*view*model*vec4(aPos,1.);}\0"};
-	inline constexpr std::string_view SHADERS_VWATER_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;layout(location=1)in vec3 aNorm;out vec3 FragPos;uniform mat4 model;uniform mat4 view;uniform mat4 projection;uniform float time;out float zPosOffset;float random(float seed){\nreturn fract(sin(seed)*43758.5453);}void main(){\nzPosOffset=sin(random(aPos.x*aPos.y)*100.f+time*2.f);vec4 modelPosition=model*vec4(aPos.x,aPos.y,aPos.z+.0075f+zPosOffset/150.f,1.f);FragPos=modelPosition.xyz/modelPosition.w;gl_Position=projection*view*modelPosition;}\0"};
+	inline constexpr std::string_view SHADERS_VBASIC_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;layout(location=1)in vec3 aNorm;//instance attributes\nlayout(location=2)in mat4 aModel;layout(location=6)in vec3 aColor;layout(location=7)in vec3 aMaterial;out vec3 FragPos;out vec3 Normal;flat out vec3 MaterialColor;flat out vec3 MaterialProperties;layout(std140)uniform Camera{\nmat4 view;mat4 projection;vec3 cameraPos;};void main(){\nFragPos=vec3(aModel*vec4(aPos,1.f));Normal=mat3(transpose(inverse(aModel)))*aNorm;MaterialColor=aColor;MaterialProperties=aMaterial;gl_Position=projection*view*vec4(FragPos,1.f);}\0"};
+	inline constexpr std::string_view SHADERS_VSIMPLE_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;uniform mat4 model;layout(std140)uniform Camera{\nmat4 view;mat4 projection;vec3 cameraPos;};void main(){\ngl_Position=projection*view*model*vec4(aPos,1.);}\0"};
+	inline constexpr std::string_view SHADERS_VWATER_GLSL {"#version 330 core\nlayout(location=0)in vec3 aPos;layout(location=1)in vec3 aNorm;out vec3 FragPos;uniform mat4 model;layout(std140)uniform Camera{\nmat4 view;mat4 projection;vec3 cameraPos;};uniform float time;out float zPosOffset;float random(float seed){\nreturn fract(sin(seed)*43758.5453);}void main(){\nzPosOffset=sin(random(aPos.x*aPos.y)*100.f+time*2.f);vec4 modelPosition=model*vec4(aPos.x,aPos.y,aPos.z+.0075f+zPosOffset/150.f,1.f);FragPos=modelPosition.xyz/modelPosition.w;gl_Position=projection*view*modelPosition;}\0"};
 }
 #define MODELS_AIRCRAFT_CARRIER _MODELS_AIRCRAFT_CARRIER_VERTICES, _MODELS_AIRCRAFT_CARRIER_INDICES, true
 inline constexpr std::array<float, 264> _MODELS_AIRCRAFT_CARRIER_VERTICES {-0.508673f, 0.278966f, -0.156084f, -0.242700f, -0.948000f, -0.205800f, -0.508673f, 0.278966f, 0.156084f, -0.246000f, -0.944100f, 0.219300f, -0.939699f, 0.294632f, 0.207074f, -0.632700f, -0.577900f, 0.515500f, -0.939699f, 0.294632f, -0.335678f, -0.596300f, -0.570000f, -0.565300f, 0.074205f, 0.156084f, 0.222029f, -0.009400f, -0.393100f, 0.919400f, 0.074205f, 0.234127f, 0.222029f, -0.005300f, -0.066900f, 0.997700f, 0.074205f, 0.278966f, 0.222029f, -0.002300f, -0.717600f, 0.696500f, -0.424598f, 0.156084f, 0.136838f, -0.558900f, -0.484300f, 0.673100f, -0.424598f, 0.156084f, -0.136838f, -0.558900f, -0.484300f, -0.673100f, 0.573007f, 0.156084f, -0.156084f, 0.642100f, -0.344000f, -0.685100f, 0.598381f, 0.278966f, -0.156084f, 0.334500f, -0.895000f, -0.295000f, 0.598381f, 0.278966f, 0.156084f, 0.334500f, -0.895000f, 0.295000f, 0.573007f, 0.156084f, 0.156084f, 0.642100f, -0.344000f, 0.685100f, 0.074205f, -0.0f, -0.047738f, -0.014900f, -0.689500f, -0.724100f, -0.424598f, -0.0f, -0.013398f, -0.841500f, -0.372800f, -0.390900f, 0.074205f, 0.156084f, -0.222029f, -0.009400f, -0.393100f, -0.919400f, 0.074205f, 0.278966f, -0.222029f, -0.001800f, -0.722600f, -0.691200f, 0.074205f, 0.234127f, -0.222029f, -0.005300f, -0.066900f, -0.997700f, -0.054239f, 0.294632f, 0.380972f, -0.374600f, -0.665100f, 0.646000f, 0.573007f, -0.0f, -0.033559f, 0.832100f, -0.382200f, -0.401900f, 0.573007f, -0.0f, 0.033559f, 0.832100f, -0.382200f, 0.401900f, 0.074205f, -0.0f, 0.047738f, -0.014900f, -0.689500f, 0.724100f, -0.424598f, -0.0f, 0.013398f, -0.841500f, -0.372800f, 0.390900f, 0.507826f, 0.294632f, -0.328704f, 0.096900f, -0.671800f, -0.734400f, 0.074205f, 0.294632f, -0.386031f, 0.030400f, -0.656000f, -0.754100f, 0.074205f, 0.307456f, -0.386031f, 0.029700f, 0.687300f, -0.725800f, 0.507826f, 0.307456f, -0.328704f, 0.092700f, 0.707100f, -0.701000f, -0.939699f, 0.307456f, -0.335678f, -0.590100f, 0.580000f, -0.561600f, 0.941447f, 0.294632f, -0.271376f, 0.618600f, -0.572000f, -0.538600f, 0.941447f, 0.294632f, 0.271376f, 0.866800f, -0.473200f, 0.157200f, 0.336848f, 0.278966f, 0.188987f, 0.091600f, -0.670200f, 0.736500f, 0.508744f, 0.294632f, 0.328582f, 0.012100f, -0.995100f, 0.098400f, 0.336293f, 0.278966f, -0.189057f, 0.092700f, -0.672000f, -0.734700f, -0.054239f, 0.307456f, 0.380972f, -0.323400f, 0.799400f, 0.506300f, -0.939699f, 0.307456f, 0.207074f, -0.624500f, 0.588200f, 0.513800f, 0.941447f, 0.307456f, -0.271376f, 0.610100f, 0.584600f, -0.534800f, 0.941447f, 0.307456f, 0.271376f, 0.730800f, 0.671100f, 0.124600f, 0.819001f, 0.307456f, 0.619910f, 0.565000f, 0.625300f, 0.538300f, 0.819001f, 0.294632f, 0.619910f, 0.724000f, -0.0f, 0.689800f, 0.491381f, 0.294632f, 0.753183f, 0.037900f, -0.0f, 0.999300f, 0.491381f, 0.307456f, 0.753183f, 0.029200f, 0.637700f, 0.769700f, 0.508744f, 0.307456f, 0.328582f, -0.0f, 1.0f, -0.0f, 0.132273f, 0.307456f, 0.637916f, -0.449000f, 0.643400f, 0.620100f, 0.132273f, 0.294632f, 0.637916f, -0.586500f, -0.0f, 0.809900f};
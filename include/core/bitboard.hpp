@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include <core/units.hpp>
+
+//one bit per grid cell, indexed like GameGrid (x + y * GRID_SIZE)
+class Bitboard
+{
+public:
+    static constexpr std::size_t BITS = GRID_SIZE * GRID_SIZE;
+    static constexpr std::size_t WORDS = (BITS + 63) / 64;
+private:
+    std::array<std::uint64_t, WORDS> m_words {};
+    static constexpr std::uint64_t LAST_WORD_MASK = BITS % 64 == 0 ? ~0ull : (1ull << BITS % 64) - 1;
+public:
+    constexpr Bitboard() = default;
+    static constexpr Bitboard full()
+    {
+        Bitboard returnValue;
+        for(auto& word : returnValue.m_words) word = ~0ull;
+        returnValue.m_words.back() &= LAST_WORD_MASK;
+        return returnValue;
+    }
+    constexpr bool test(std::size_t index) const {return m_words[index / 64] >> (index % 64) & 1ull;}
+    constexpr void set(std::size_t index) {m_words[index / 64] |= 1ull << (index % 64);}
+    constexpr void reset(std::size_t index) {m_words[index / 64] &= ~(1ull << (index % 64));}
+    constexpr void set(std::size_t index, bool value)
+    {
+        if(value) set(index);
+        else reset(index);
+    }
+    constexpr void clear() {m_words = {};}
+    constexpr bool any() const
+    {
+        for(auto word : m_words) if(word) return true;
+        return false;
+    }
+    constexpr bool none() const {return !any();}
+    constexpr int count() const
+    {
+        int returnValue {};
+        for(auto word : m_words) returnValue += std::popcount(word);
+        return returnValue;
+    }
+    //calls func(index) for every set bit in increasing order
+    template<typename F>
+    constexpr void forEach(F&& func) const
+    {
+        for(std::size_t i {}; i < WORDS; ++i)
+        {
+            for(std::uint64_t word = m_words[i]; word; word &= word - 1)
+                func(i * 64 + std::countr_zero(word));
+        }
+    }
+    constexpr Bitboard& operator|=(const Bitboard& other)
+    {
+        for(std::size_t i {}; i < WORDS; ++i) m_words[i] |= other.m_words[i];
+        return *this;
+    }
+    constexpr Bitboard& operator&=(const Bitboard& other)
+    {
+        for(std::size_t i {}; i < WORDS; ++i) m_words[i] &= other.m_words[i];
+        return *this;
+    }
+    constexpr Bitboard& operator^=(const Bitboard& other)
+    {
+        for(std::size_t i {}; i < WORDS; ++i) m_words[i] ^= other.m_words[i];
+        return *this;
+    }
+    constexpr Bitboard operator~() const
+    {
+        Bitboard returnValue;
+        for(std::size_t i {}; i < WORDS; ++i) returnValue.m_words[i] = ~m_words[i];
+        returnValue.m_words.back() &= LAST_WORD_MASK;
+        return returnValue;
+    }
+    friend constexpr Bitboard operator|(Bitboard lhs, const Bitboard& rhs) {return lhs |= rhs;}
+    friend constexpr Bitboard operator&(Bitboard lhs, const Bitboard& rhs) {return lhs &= rhs;}
+    friend constexpr Bitboard operator^(Bitboard lhs, const Bitboard& rhs) {return lhs ^= rhs;}
+    friend constexpr bool operator==(const Bitboard&, const Bitboard&) = default;
+};
\ No newline at end of file
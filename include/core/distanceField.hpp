@@ -0,0 +1,34 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <core/units.hpp>
+#include <core/bitboard.hpp>
+
+//the cost of the cheapest path from one origin to every cell of the grid, computed in one Dijkstra pass.
+//Uses the same costs as GameGrid::findPath, so the paths found here are equally short
+class DistanceField
+{
+public:
+    static constexpr int STRAIGHT_COST = 10;
+    static constexpr int DIAGONAL_COST = 14;
+    static constexpr int UNREACHABLE = std::numeric_limits<int>::max();
+private:
+    std::array<int, GRID_SIZE * GRID_SIZE> m_costs;
+    std::array<std::uint16_t, GRID_SIZE * GRID_SIZE> m_parents;//the previous cell of the path
+    std::array<std::uint16_t, GRID_SIZE * GRID_SIZE> m_firstSteps;//the cell the path leaves the origin to
+    Bitboard m_reached;
+    std::size_t m_origin {};
+public:
+    void compute(std::size_t origin, const Bitboard& obstacles);
+    std::size_t getOrigin() const {return m_origin;}
+    const Bitboard& getReached() const {return m_reached;}
+    bool isReachable(std::size_t index) const {return m_reached.test(index);}
+    int getCost(std::size_t index) const {return m_reached.test(index) ? m_costs[index] : UNREACHABLE;}
+    std::size_t getParent(std::size_t index) const {return m_parents[index];}
+    std::size_t getFirstStep(std::size_t index) const {return m_firstSteps[index];}
+    std::size_t getPathLength(std::size_t index) const;//in cells including the origin, 0 when unreachable
+};
\ No newline at end of file
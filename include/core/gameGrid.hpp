@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <deque>
+#include <span>
+#include <optional>
+
+#include <core/units.hpp>
+#include <core/bitboard.hpp>
+#include <core/distanceField.hpp>
+
+struct GridCell
+{
+    UnitTypes type {UnitTypes::none};
+    Team team {Team::neutral};
+    bool usedAttack {};
+    int health {};
+};
+
+//receives the changes of the grid, e.g. to keep the 3D objects in sync with the rules
+class GridListener
+{
+public:
+    using Loc = std::pair<std::size_t, std::size_t>;
+    virtual ~GridListener() = default;
+    virtual void onGridObjectCreated(std::size_t index, UnitTypes type, Team team) {}
+    virtual void onGridObjectDestroyed(std::size_t index) {}
+    virtual void onGridObjectMoved(const std::deque<Loc>& path) {}
+};
+
+class GameGrid
+{
+public:
+    using Loc = GridListener::Loc;
+    using Path = std::deque<Loc>;
+    using PathBuffer = std::array<Loc, GRID_SIZE * GRID_SIZE>;//large enough for any path
+    struct SelectableSquares
+    {
+        Bitboard squares;
+        Bitboard nonInteractable;//shown but cannot be selected
+    };
+private:
+    std::array<GridCell, GRID_SIZE * GRID_SIZE> m_base;
+    //the index of the object in m_base that owns the cell. Differs from the cell's own index only for the cells of large objects (bases and islands)
+    std::array<std::uint16_t, GRID_SIZE * GRID_SIZE> m_anchors {[]()
+    {
+        std::array<std::uint16_t, GRID_SIZE * GRID_SIZE> returnValue {};
+        for(std::size_t i {}; i < returnValue.size(); ++i) returnValue[i] = static_cast<std::uint16_t>(i);
+        return returnValue;
+    }()};
+    static_assert(GRID_SIZE * GRID_SIZE <= 1 << 16);
+    GridListener* m_listener {};
+    //bitboards mirroring m_base. Every cell of a large object is set
+    Bitboard m_occupied;
+    std::array<Bitboard, 3> m_teams;//indexed by Team
+    std::array<Bitboard, static_cast<std::size_t>(UnitTypes::count)> m_types;
+    Bitboard m_large;
+    std::uint32_t m_generation {};
+    std::uint64_t m_hash {};//Zobrist hash of the objects, their health and their used attacks
+    //the last distance field that was asked for. It's reused until the objects move, so the move preview and the path share one computation
+    mutable DistanceField m_distanceField;
+    mutable std::optional<std::uint32_t> m_distanceFieldGeneration;
+    //the last selectable squares that were asked for, e.g. by the action preview and then by the validation of its target
+    struct SelectableSquaresKey
+    {
+        std::uint32_t generation {};
+        std::size_t origin {};
+        int radius {};
+        SelectOnGridTypes selectType {};
+        bool blockable {};
+        friend bool operator==(const SelectableSquaresKey&, const SelectableSquaresKey&) = default;
+    };
+    mutable SelectableSquares m_selectableSquares;
+    mutable std::optional<SelectableSquaresKey> m_selectableSquaresKey;
+    void computeSelectableSquares(Loc loc, int radius, SelectOnGridTypes selectType, bool blockable, SelectableSquares& squares) const;
+    void updateMasks(std::size_t anchorIndex, bool value);
+    std::uint64_t getCellKey(std::size_t anchorIndex) const;
+    std::size_t findPathInDistanceField(std::size_t targetIndex, std::span<Loc> path) const;
+public:
+    GameGrid(GridListener* listener = nullptr) : m_listener(listener) {}
+    void setListener(GridListener* listener) {m_listener = listener;}
+    const GridCell* initializeAt(UnitTypes type, std::size_t x, std::size_t y, Team team = Team::neutral);
+    const GridCell* initializeAt(UnitTypes type, Loc loc, Team team = Team::neutral);
+    const GridCell* at(std::size_t x, std::size_t y) const;
+    const GridCell* at(Loc loc) const;
+    //the cells are only changed through the grid so that the hash stays up to date
+    int addHealth(Loc loc, int health);//clamped to the maximum health. Returns the new health
+    void setUsedAttack(Loc loc, bool usedAttack);
+    void destroy(const GridCell* ptr);
+    void destroyAt(Loc loc);
+    void destroyAt(std::size_t index);
+    void moveAt(Loc loc1, Loc loc2);
+    //the paths from the object at the origin to every cell. Cached until the next change of the generation
+    const DistanceField& getDistanceField(Loc origin) const;
+    //writes the path into the buffer and returns its length, or 0 when there is no path. When the buffer is too small, only the length is returned
+    [[nodiscard]] std::size_t findPath(Loc startPos, Loc movePos, std::span<Loc> path, bool avoidObstacles = true) const;
+    [[nodiscard]] Path findPath(Loc startPos, Loc movePos, bool avoidObstacles = true) const;
+    void moveAlongPath(const Path& path);//moves the object from the path's start to its end
+    //cached like the distance field
+    const SelectableSquares& getSelectableSquares(Loc loc, int radius, SelectOnGridTypes selectType, bool blockable) const;
+    static constexpr int size() {return GRID_SIZE * GRID_SIZE;}
+    std::uint32_t getGeneration() const {return m_generation;}//changes whenever an object is created, destroyed or moved
+    std::uint64_t getHash() const {return m_hash;}
+    const Bitboard& getOccupied() const {return m_occupied;}
+    const Bitboard& getTeamMask(Team team) const {return m_teams[static_cast<std::size_t>(team)];}
+    const Bitboard& getTypeMask(UnitTypes type) const {return m_types[static_cast<std::size_t>(type)];}
+    const Bitboard& getIslandMask() const {return getTypeMask(UnitTypes::island);}
+    const Bitboard& getLargeMask() const {return m_large;}
+    Bitboard getObjectMask(Loc loc) const;//all the cells of the object at the location
+    std::pair<const GridCell*, std::size_t> operator[](std::size_t index) const;//the return value's second part corrects the index when the object is larger than one index
+    std::size_t getAnchorIndex(const GridCell* cell) const {return static_cast<std::size_t>(cell - m_base.data());}//the index the object was initialized to
+    static Loc convertIndexToLocation(std::size_t index);
+    static std::size_t convertLocationToIndex(Loc loc);
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <core/units.hpp>
+#include <core/bitboard.hpp>
+#include <core/random.hpp>
+#include <core/match.hpp>
+
+struct StateCell
+{
+    UnitTypes type {UnitTypes::none};
+    Team team {Team::neutral};
+    std::int16_t health {};
+};
+static_assert(sizeof(StateCell) == 4);
+
+//a snapshot of a match that can be copied with memcpy, e.g. for search, rollback and saving.
+//Objects are stored at their anchor index only: large objects are always initialized to even coordinates.
+//The moves don't check the rules, so only decisions that are legal in the Match of the same state should be made
+struct GameState
+{
+    std::array<StateCell, GRID_SIZE * GRID_SIZE> cells;
+    Bitboard usedAttacks;
+    PlayerData playerOne;
+    PlayerData playerTwo;
+    int turnNumber {};
+    bool playerOneToPlay {true};
+    bool gameOver {};
+    RandomStream random;
+
+    //everything a move may change, so it can be taken back
+    struct Undo
+    {
+        struct ChangedCell
+        {
+            std::uint16_t index;
+            StateCell cell;
+        };
+        std::array<ChangedCell, 2> changedCells;
+        std::uint8_t changedCellCount {};
+        Bitboard usedAttacks;
+        PlayerData playerOne;
+        PlayerData playerTwo;
+        int turnNumber {};
+        bool playerOneToPlay {};
+        bool gameOver {};
+        RandomStream random;
+    };
+
+    PlayerData& currentPlayerData() {return playerOneToPlay ? playerOne : playerTwo;}
+    const PlayerData& currentPlayerData() const {return playerOneToPlay ? playerOne : playerTwo;}
+    std::size_t getObjectIndex(std::size_t index) const;//the anchor index of the object covering the cell, or the index itself when it's empty
+    Undo makeMove(const Decision& decision);//mirrors Match::useAction and Match::endTurn
+    void unmakeMove(const Undo& undo);
+};
+static_assert(std::is_trivially_copyable_v<GameState>);
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <vector>
+
+#include <core/units.hpp>
+#include <core/gameGrid.hpp>
+#include <core/random.hpp>
+
+inline constexpr int PLAYER_STARTING_MONEY = 400;
+inline constexpr int PLAYER_STARTING_TURN_MONEY = 200;
+struct PlayerData
+{
+    int money {PLAYER_STARTING_MONEY};
+    int moves {2};
+    int maxMoves {2};
+    int turnMoney = PLAYER_STARTING_TURN_MONEY;
+};
+
+class MatchListener : public GridListener
+{
+public:
+    virtual void onGameOver(bool playerOneWins) {}
+};
+
+struct ActionResult
+{
+    bool used {};
+    GameGrid::Path path;//the path the unit moved along, or the path from the base to the bought unit
+};
+
+struct GameState;
+
+//one choice of the player to play: using an action of a unit or ending the turn
+struct Decision
+{
+    bool endTurn {};
+    GameGrid::Loc unit {};
+    std::size_t actionIndex {};
+    std::optional<GameGrid::Loc> target;
+    friend bool operator==(const Decision&, const Decision&) = default;
+};
+
+//the rules of one match without any rendering or input, so that it can be simulated headlessly
+class Match
+{
+public:
+    using Loc = GameGrid::Loc;
+private:
+    bool m_playerOneToPlay {true};
+    bool m_gameOver {};
+    GameGrid m_grid;
+    std::pair<PlayerData, PlayerData> m_playerData;
+    int m_turnNumber {};
+    MatchListener* m_listener {};
+    std::uint64_t m_seed;
+    RandomStream m_random;//the placement of the objects and the damage. Copied with the match, so a copy plays out the same
+    PlayerData& currentPlayerData() {return m_playerOneToPlay ? m_playerData.first : m_playerData.second;}
+    void applyDamage(Loc target, int damage);
+public:
+    Match(MatchListener* listener = nullptr) : Match(listener, createRandomSeed()) {}
+    Match(MatchListener* listener, std::uint64_t seed);//the same seed and decisions always play out the same
+    void setListener(MatchListener* listener);//e.g. to simulate a copy of the match without affecting the view
+    GameState getState() const;
+    void setState(const GameState& state);//replaces the objects of the grid, which the listener is notified about
+    std::uint64_t getHash() const;//Zobrist hash of the grid, the player data and the player to play
+    std::uint64_t getSeed() const {return m_seed;}//the seed the match was created with
+    const RandomStream& getRandom() const {return m_random;}
+    void setRandom(const RandomStream& random) {m_random = random;}//e.g. to sample different damage in a simulated copy
+    int getMoney() const;
+    void addMoney(int money);
+    void setTurnData(int maxMoves, int money);
+    void takeMove();
+    bool canMove() const;
+    int getTurnNumber() const {return m_turnNumber;}
+    bool isPlayerOneToPlay() const {return m_playerOneToPlay;}
+    bool isGameOver() const {return m_gameOver;}
+    Team getCurrentTeam() const {return m_playerOneToPlay ? Team::playerOne : Team::playerTwo;}
+    const PlayerData& getPlayerData(bool playerOne) const {return playerOne ? m_playerData.first : m_playerData.second;}
+    const GameGrid& getGameGrid() const {return m_grid;}
+    void endTurn();
+
+    //actions of the unit at the location, indexed like UnitDefinition::actions
+    bool isActionUsable(Loc unitLoc, std::size_t actionIndex) const;
+    bool requiresTarget(Loc unitLoc, std::size_t actionIndex) const;
+    GameGrid::SelectableSquares getActionSquares(Loc unitLoc, std::size_t actionIndex) const;
+    bool isValidTarget(Loc unitLoc, std::size_t actionIndex, Loc target) const;
+    ActionResult useAction(Loc unitLoc, std::size_t actionIndex, std::optional<Loc> target = std::nullopt);
+
+    //every decision the player to play can make. Ending the turn is always the first one
+    void getLegalDecisions(std::vector<Decision>& decisions) const;
+    bool isLegal(const Decision& decision) const;
+    ActionResult apply(const Decision& decision);
+};
\ No newline at end of file
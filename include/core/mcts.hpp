@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <core/match.hpp>
+#include <core/threadPool.hpp>
+#include <core/transpositionTable.hpp>
+
+struct MctsSettings
+{
+    std::chrono::milliseconds timeBudget {1000};
+    std::size_t iterationBudget {};//when not 0, every tree stops after this many iterations instead of at the time budget, which makes the search reproducible with one thread
+    std::size_t threadCount {ThreadPool::defaultThreadCount()};//with one thread the search runs on the calling thread
+    float exploration {.5f};
+    int rolloutTurns {};//the leaves are played randomly until this many turns from the root have passed. With 0 the leaves are evaluated directly, which suits the heuristic evaluation better than random play
+    int maxRolloutDecisionsPerTurn {4};
+    int transpositionTableSizeLog2 {20};//entries of 8 bytes
+};
+
+//the chance of player one winning, estimated from the units, the bases and the money
+float evaluateMatch(const Match& match);
+
+//chooses the decisions of the player to play with Monte Carlo tree search.
+//Every worker of the pool grows its own tree from the same root (root parallelism) and the visits of the root's children are summed.
+//The trees are open loop: the state is replayed from the root on every iteration, so the random damage is sampled again each time.
+//The trees share the statistics of the positions they reach through a transposition table, which is kept between the searches
+class MctsPlayer
+{
+private:
+    MctsSettings m_settings;
+    std::unique_ptr<ThreadPool> m_pool;
+    TranspositionTable m_transpositions;
+    std::size_t m_lastIterationCount {};
+public:
+    explicit MctsPlayer(const MctsSettings& settings = {});
+    Decision search(const Match& match);
+    std::size_t getLastIterationCount() const {return m_lastIterationCount;}//summed over all the trees of the last search
+    const MctsSettings& getSettings() const {return m_settings;}
+};
\ No newline at end of file
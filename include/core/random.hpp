@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+concept IsIntegral = std::is_integral_v<T>;
+
+//a seed from the system's entropy, e.g. for a new game. Everything random in a match comes from its own RandomStream
+std::uint64_t createRandomSeed();
+
+//a small PCG32 generator whose state can be stored and copied with a game state
+class RandomStream
+{
+private:
+    std::uint64_t m_state {};
+    std::uint64_t m_increment {1};
+public:
+    constexpr RandomStream() = default;
+    constexpr explicit RandomStream(std::uint64_t seed, std::uint64_t stream = 0) : m_increment((stream << 1) | 1u)
+    {
+        next();
+        m_state += seed;
+        next();
+    }
+    constexpr std::uint32_t next()
+    {
+        std::uint64_t oldState = m_state;
+        m_state = oldState * 6364136223846793005ull + m_increment;
+        std::uint32_t xorShifted = static_cast<std::uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+        std::uint32_t rotation = static_cast<std::uint32_t>(oldState >> 59u);
+        return (xorShifted >> rotation) | (xorShifted << ((-rotation) & 31u));
+    }
+    //the ranges in the game are small, so the slight bias of the multiply-shift reduction doesn't matter. At most 2^32 values
+    template<IsIntegral T>
+    constexpr T get(T min, T max)
+    {
+        if(min > max) std::swap(min, max);
+        std::uint64_t range = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+        assert(range && range <= 1ull << 32);
+        return static_cast<T>(static_cast<std::uint64_t>(min) + ((next() * range) >> 32));
+    }
+    friend constexpr bool operator==(const RandomStream&, const RandomStream&) = default;
+};
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <core/match.hpp>
+#include <core/gameState.hpp>
+
+//the seed and the decisions of a match, which is all it takes to play it again.
+//Saved as the magic, the version, the grid size, the seed and the decision count followed by three bytes per decision, all little-endian
+class Replay
+{
+public:
+    static constexpr std::array<char, 4> MAGIC {'N', 'C', 'R', 'P'};
+    static constexpr std::uint16_t VERSION = 1;
+private:
+    //the unit's and the target's index and the flags
+    struct PackedDecision
+    {
+        std::uint8_t unit {};
+        std::uint8_t target {};
+        std::uint8_t flags {};//the action index in the low bits
+    };
+    static_assert(GRID_SIZE * GRID_SIZE <= 256, "Indices have to fit in one byte");
+    static constexpr std::uint8_t ACTION_INDEX_MASK = 0x1f, HAS_TARGET_FLAG = 0x20, END_TURN_FLAG = 0x40;
+    std::uint64_t m_seed {};
+    std::vector<PackedDecision> m_decisions;
+public:
+    explicit Replay(std::uint64_t seed = 0) : m_seed(seed) {}
+    std::uint64_t getSeed() const {return m_seed;}
+    std::size_t size() const {return m_decisions.size();}
+    void add(const Decision& decision);
+    Decision getDecision(std::size_t index) const;
+    void truncate(std::size_t size);//e.g. to continue playing from the middle of the replay
+    std::vector<std::uint8_t> serialize() const;
+    static std::optional<Replay> deserialize(std::span<const std::uint8_t> data);
+    bool save(const std::filesystem::path& path) const;
+    static std::optional<Replay> load(const std::filesystem::path& path);
+};
+
+//plays a replay headlessly without pathfinding or animations, using the snapshots taken on the way to seek
+class ReplayPlayer
+{
+public:
+    static constexpr std::size_t DEFAULT_SNAPSHOT_INTERVAL = 64;
+private:
+    const Replay& m_replay;
+    GameState m_state;
+    std::size_t m_position {};
+    std::size_t m_snapshotInterval;
+    std::vector<GameState> m_snapshots;//the state before the decisions at multiples of the interval. Taken the first time the position is played
+    std::vector<std::size_t> m_turnStarts;//the position of the first decision of every turn
+public:
+    explicit ReplayPlayer(const Replay& replay, std::size_t snapshotInterval = DEFAULT_SNAPSHOT_INTERVAL);
+    const GameState& getState() const {return m_state;}
+    std::size_t getPosition() const {return m_position;}//the number of decisions played
+    int getTurnCount() const {return static_cast<int>(m_turnStarts.size());}
+    bool step();//plays the next decision. Returns false at the end or when the decision doesn't fit the state, e.g. because the file is corrupted
+    bool seek(std::size_t position);//returns whether the position was reached
+    bool seekToTurn(int turn);//to the start of the turn
+};
\ No newline at end of file
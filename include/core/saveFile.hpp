@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+#include <core/gameState.hpp>
+
+//game states saved as they are in memory after a fixed header, so that opening a file, even an archive of many positions, is one mapping and a validation without any parsing.
+//The layout follows GameState, so the version has to change whenever GameState does
+class SaveFile
+{
+public:
+    static constexpr std::array<char, 4> MAGIC {'N', 'C', 'S', 'V'};
+    static constexpr std::uint32_t VERSION = 1;
+    struct Header
+    {
+        std::array<char, 4> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrder;//BYTE_ORDER_MARK as written by the machine that saved the file
+        std::uint32_t gridSize;
+        std::uint64_t stateSize;
+        std::uint64_t stateCount;
+    };
+    static constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static_assert(sizeof(Header) == 32 && sizeof(Header) % alignof(GameState) == 0, "The states have to be aligned in the mapping");
+private:
+    const std::byte* m_data {};
+    std::size_t m_size {};
+#ifdef _WIN32
+    void* m_mappingHandle {};
+#endif
+    SaveFile() = default;
+    void unmap();
+public:
+    SaveFile(SaveFile&& other) noexcept;
+    SaveFile& operator=(SaveFile&& other) noexcept;
+    ~SaveFile();
+    static bool save(const std::filesystem::path& path, std::span<const GameState> states);
+    static std::optional<SaveFile> open(const std::filesystem::path& path);//nullopt when the file can't be mapped or any of its states is invalid
+    std::span<const GameState> getStates() const;
+    static bool isValid(const GameState& state);//the objects fit the grid and the values are in their ranges
+};
\ No newline at end of file
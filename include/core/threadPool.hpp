@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//a fixed number of worker threads running the submitted tasks. Every worker has its own queue, and a worker whose queue is empty steals from the back of the others.
+//The tasks are counted atomically, so the pool's mutex is taken only to put a worker to sleep or to wake one, and busy workers don't contend on one lock
+class ThreadPool
+{
+private:
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::vector<std::thread> m_workers;
+    std::atomic<std::size_t> m_nextQueue {};
+    //the tasks in the queues that no worker has reserved yet
+    std::atomic<std::size_t> m_pendingTasks {};
+    //the sleeping workers are woken when a task is pushed
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::atomic<std::size_t> m_sleepingWorkers {};
+    bool m_stopping {};
+    bool reserveTask();
+    void push(std::function<void()> task);
+    bool pop(std::size_t queueIndex, std::function<void()>& task);
+    void work(std::size_t queueIndex);
+public:
+    explicit ThreadPool(std::size_t threadCount = defaultThreadCount());
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    static std::size_t defaultThreadCount();//one per core
+    std::size_t getThreadCount() const {return m_workers.size();}
+    template<typename F>
+    auto submit(F&& func) -> std::future<std::invoke_result_t<F>>
+    {
+        //std::function has to be copyable, hence the shared task
+        auto task = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(func));
+        auto returnValue = task->get_future();
+        push([task](){(*task)();});
+        return returnValue;
+    }
+};
\ No newline at end of file
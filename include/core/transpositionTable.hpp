@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+//the statistics of the positions reached by the search, shared by its threads. Different move orders often reach the same position, so its evaluations are averaged instead of repeated.
+//Fixed size and lock-free: an entry is one 64-bit word updated with compare and swap, and a colliding position replaces the old one
+class TranspositionTable
+{
+public:
+    struct Statistics
+    {
+        std::uint32_t visits {};
+        float reward {};//the average for player one
+    };
+private:
+    //the bits of an entry from the lowest: the average reward as a fraction of REWARD_SCALE, the visits and the check bits of the hash
+    static constexpr int REWARD_BITS = 16, VISIT_BITS = 26, CHECK_BITS = 64 - REWARD_BITS - VISIT_BITS;
+    static constexpr std::uint64_t REWARD_SCALE = (1ull << REWARD_BITS) - 1, MAX_VISITS = (1ull << VISIT_BITS) - 1;
+    std::vector<std::atomic<std::uint64_t>> m_entries;
+    std::size_t m_mask;
+    static std::uint64_t getCheck(std::uint64_t hash) {return hash >> (64 - CHECK_BITS);}
+public:
+    explicit TranspositionTable(int sizeLog2);
+    std::optional<Statistics> probe(std::uint64_t hash) const;
+    void add(std::uint64_t hash, float reward);
+    void clear();
+    std::size_t size() const {return m_entries.size();}
+};
\ No newline at end of file
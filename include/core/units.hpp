@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+inline constexpr int GRID_SIZE = 16;
+static_assert(GRID_SIZE % 2 == 0);
+
+enum class Team : std::uint8_t
+{
+    playerOne,
+    playerTwo,
+    neutral
+};
+
+enum class UnitTypes : std::uint8_t
+{
+    none,
+    island,
+    base,
+    baseUpgrade1,
+    baseUpgrade2,
+    submarine,
+    submarineUpgrade1,
+    ship,
+    aircraftCarrier,
+    aircraftCarrierUpgrade1,
+    count
+};
+
+enum class SelectOnGridTypes : std::uint8_t
+{
+    cross,
+    area,
+    selectEnemyUnit,
+};
+
+enum class ActionKinds : std::uint8_t
+{
+    move,
+    attack,
+    buyUnit,
+    upgrade,
+    sell
+};
+
+struct ActionDefinition
+{
+    ActionKinds kind {};
+    int price {};
+    int radius {};
+    SelectOnGridTypes selectType {SelectOnGridTypes::area};
+    int damage {};
+    UnitTypes unit {};//the unit to buy or to upgrade to
+    int newMaxMoves {};//only base upgrades change the turn data
+    int newTurnMoney {};
+    int worth {};
+};
+
+inline constexpr std::size_t UNIT_ACTIONS_MAX_COUNT = 4;
+struct UnitDefinition
+{
+    std::string_view name;
+    int health {};
+    bool large {};
+    std::array<ActionDefinition, UNIT_ACTIONS_MAX_COUNT> actions {};
+    std::size_t actionsCount {};
+};
+
+inline constexpr int BASE_HEALTH = 800;
+inline constexpr int DAMAGE_SPREAD = 25;//the damage of an attack varies this much in both directions
+
+const UnitDefinition& getUnitDefinition(UnitTypes type);
+constexpr bool isBase(UnitTypes type)
+{
+    return type == UnitTypes::base || type == UnitTypes::baseUpgrade1 || type == UnitTypes::baseUpgrade2;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <core/units.hpp>
+
+//keys of the features of a position. The hash of a position is the xor of the keys of its features, so a change updates it with a couple of xors.
+//The keys are derived from the feature with the splitmix64 finalizer instead of being stored in tables, which keeps them out of the cache
+inline constexpr int HEALTH_BUCKET_SIZE = 25;//the damage is random, so health within a bucket counts as the same position
+
+constexpr std::uint64_t mixZobristKey(std::uint64_t value)
+{
+    value += 0x9e3779b97f4a7c15ull;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+//the object anchored to the cell
+constexpr std::uint64_t getObjectKey(std::size_t index, UnitTypes type, Team team)
+{
+    return mixZobristKey(index << 16 | static_cast<std::uint64_t>(type) << 8 | static_cast<std::uint64_t>(team));
+}
+constexpr std::uint64_t getHealthKey(std::size_t index, int health)
+{
+    return mixZobristKey(1ull << 48 | index << 16 | static_cast<std::uint64_t>(health / HEALTH_BUCKET_SIZE));
+}
+constexpr std::uint64_t getUsedAttackKey(std::size_t index)
+{
+    return mixZobristKey(2ull << 48 | index);
+}
+constexpr std::uint64_t getPlayerKey(bool playerOne, int money, int moves, int maxMoves, int turnMoney)
+{
+    std::uint64_t returnValue = mixZobristKey(3ull << 48 | (playerOne ? 1u : 0u));
+    returnValue = mixZobristKey(returnValue ^ static_cast<std::uint32_t>(money));
+    returnValue = mixZobristKey(returnValue ^ static_cast<std::uint32_t>(turnMoney));
+    return mixZobristKey(returnValue ^ static_cast<std::uint64_t>(moves) << 32 ^ static_cast<std::uint32_t>(maxMoves));
+}
+inline constexpr std::uint64_t PLAYER_TWO_TO_PLAY_KEY = mixZobristKey(4ull << 48);
\ No newline at end of file
@@ -15,6 +15,7 @@ public:
     Camera(glm::vec3 position);
     void onWindowResize(int width, int height);
     virtual void update() {};
+    virtual bool isMoving() const {return false;}//whether the view changes in the next update
     glm::mat4 getProjection() const {return m_projection;}
     glm::mat4 getView() const {return m_view;}
     glm::vec3 getPosition() const {return m_position;}
@@ -24,7 +25,7 @@ class OrbitingCamera : public Camera
 {
 private:
     float m_time {};
-    bool m_decreasing {}, m_stopped {};
+    bool m_decreasing {}, m_stopped {}, m_orbiting {true};
     float m_currentPercentageOfCircle {};
     struct ZoomPropertiess
     {
@@ -45,8 +46,10 @@ public:
         : Camera(glm::vec3(0.f, height, 0.f)), m_speed(speed), m_radius(radius), m_height(height),
         m_lookAtPoint(std::move(lookAtPoint)), m_maxPercentageOfCircle(angle / 360.f) {}
     void update() override;
+    bool isMoving() const override;
     void zoom(glm::vec3 zoomLookAtPoint, float zoomHeight, float zoomRadius, float transitionTime = 0.f);
     void stopZoom();
     void stopMovement();
     void continueMovement();
+    void setOrbiting(bool orbiting) {m_orbiting = orbiting;}//the view stays still until it's zoomed
 };
\ No newline at end of file
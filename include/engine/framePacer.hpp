@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <engine/sampleHistory.hpp>
+
+enum class FramePacingModes : std::uint8_t
+{
+    uncapped,
+    capped,//waits until the frame time of the frame rate cap has passed
+    vsync//the swap of the buffers waits for the display
+};
+
+//in milliseconds over the last frames
+struct FrameTimeStatistics
+{
+    float average {}, p50 {}, p95 {}, p99 {};
+    float jitter {};//the average difference between the times of consecutive frames
+    std::size_t samples {};
+};
+
+//ends the frames at an even rate. Sleeping overshoots by up to a scheduler tick, so it sleeps only while the wait
+//is longer than the longest recent sleep and spins for the rest
+class FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr float DEFAULT_FRAME_RATE {160.f};
+private:
+    FramePacingModes m_mode {FramePacingModes::capped};
+    Clock::duration m_frameTime;
+    Clock::time_point m_lastFrame {Clock::now()}, m_deadline {m_lastFrame};
+    Clock::duration m_sleepEstimate {std::chrono::milliseconds(2)};//of a sleep of SLEEP_STEP
+    SampleHistory m_frameTimes, m_jitters;
+    float m_previousFrameTime {};
+    void waitUntil(Clock::time_point time);
+    void addFrameTime(float frameTime);
+public:
+    FramePacer();
+    void setMode(FramePacingModes mode, float frameRate = DEFAULT_FRAME_RATE);
+    FramePacingModes getMode() const {return m_mode;}
+    float getFrameRate() const;
+    float endFrame();//waits for the end of the frame and returns its length in seconds
+    void restart();//the next frame is measured from now, e.g. after waiting for events
+    FrameTimeStatistics getStatistics() const;
+};
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <concepts>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t CAPACITY>
+class InplaceFunction;
+
+//like std::function, but the callable is stored in the object itself, so it never allocates. A callable that doesn't fit is a compile error
+template<typename R, typename... Args, std::size_t CAPACITY>
+class InplaceFunction<R(Args...), CAPACITY>
+{
+private:
+    alignas(std::max_align_t) std::array<std::byte, CAPACITY> m_storage;
+    R (*m_invoke)(void* callable, Args... args) {};
+    void (*m_move)(void* to, void* from) {};//move constructs the callable and destroys the old one
+    void (*m_destroy)(void* callable) {};
+    void moveFrom(InplaceFunction& other)
+    {
+        if(!other.m_invoke) return;
+        other.m_move(m_storage.data(), other.m_storage.data());
+        m_invoke = std::exchange(other.m_invoke, nullptr);
+        m_move = std::exchange(other.m_move, nullptr);
+        m_destroy = std::exchange(other.m_destroy, nullptr);
+    }
+public:
+    InplaceFunction() = default;
+    template<typename F>
+        requires (!std::same_as<std::decay_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    InplaceFunction(F&& func)
+    {
+        using Callable = std::decay_t<F>;
+        static_assert(sizeof(Callable) <= CAPACITY, "The callable is too large for the buffer, capture less or raise the capacity");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "The callable is aligned more than the buffer");
+        new(m_storage.data()) Callable(std::forward<F>(func));
+        m_invoke = [](void* callable, Args... args) -> R
+        {
+            return std::invoke(*static_cast<Callable*>(callable), std::forward<Args>(args)...);
+        };
+        m_move = [](void* to, void* from)
+        {
+            new(to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        };
+        m_destroy = [](void* callable)
+        {
+            static_cast<Callable*>(callable)->~Callable();
+        };
+    }
+    InplaceFunction(InplaceFunction&& other) noexcept
+    {
+        moveFrom(other);
+    }
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+    ~InplaceFunction()
+    {
+        reset();
+    }
+    void reset()
+    {
+        if(m_destroy) m_destroy(m_storage.data());
+        m_invoke = nullptr;
+        m_move = nullptr;
+        m_destroy = nullptr;
+    }
+    R operator()(Args... args)
+    {
+        return m_invoke(m_storage.data(), std::forward<Args>(args)...);
+    }
+    explicit operator bool() const {return m_invoke;}
+};
\ No newline at end of file
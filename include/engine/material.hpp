@@ -0,0 +1,14 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+struct Material
+{
+    glm::vec3 color {};
+    float ambientStrength {};
+    float shininess {};
+    float specularStrength {};
+};
+//the attribute locations of the material in the basic shader. Per instance, or per vertex in merged meshes
+inline constexpr unsigned int MATERIAL_COLOR_LOCATION {6};
+inline constexpr unsigned int MATERIAL_PROPERTIES_LOCATION {7};//ambient strength, shininess and specular strength
\ No newline at end of file
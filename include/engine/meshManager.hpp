@@ -3,19 +3,29 @@
 #include <memory>
 #include <unordered_map>
 #include <cstddef>
+#include <span>
 
 #include <glad/glad.h>
 
+#include <engine/material.hpp>
+
 struct Mesh
 {
     unsigned int VAO {};
     unsigned int indicesLength {};
     unsigned int vertexCount {};
+    bool vertexMaterials {};//the material of each vertex is in the mesh instead of the instance data
 
-    void use() const
-    {
-        glBindVertexArray(VAO);
-    }
+    void use() const;
+};
+
+//a model merged with the others into one mesh, e.g. a part of a unit
+struct MeshPart
+{
+    std::span<const float> vertices;
+    std::span<const unsigned int> indices;
+    bool normals {};
+    Material material {};
 };
 
 enum class NormalMode
@@ -40,6 +50,7 @@ private:
     };
     std::unordered_map<int, MeshVariations> m_gridMeshes;
     std::unordered_map<const void*, Mesh> m_loadedMeshes;
+    std::unordered_map<int, Mesh> m_mergedMeshes;
 public:
     static MeshManager& getInstance()
     {
@@ -57,4 +68,6 @@ public:
         return m_loadedMeshes[&vertices];
     }
     Mesh getGrid(int size, NormalMode normals);
+    //the parts are merged only the first time the key is used, so the same key must always come with the same parts
+    Mesh getMergedMesh(int key, std::span<const MeshPart> parts);
 };
\ No newline at end of file
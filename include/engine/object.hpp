@@ -3,63 +3,84 @@
 #include <memory>
 #include <concepts>
 #include <vector>
+#include <span>
+#include <cstdint>
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 
 #include <engine/meshManager.hpp>
+#include <engine/material.hpp>
 #include <engine/renderEngine.hpp>
+#include <engine/shader.hpp>
 
-class Shader;
 class Object
 {
 private:
     bool m_useTime;
+    bool m_visible {true};
+    ObjectKinds m_kind;
+    RenderHandle m_renderHandle;
 protected:
     Mesh m_mesh;
     Shader* m_shader {};
+    Uniform<float> m_timeUniform;
     void drawMesh() const;
     virtual void configureShaders() const;; 
     glm::mat4 m_model {};
     Object3DRenderTypes m_renderType;
 public:
-    Object(Mesh mesh, Shader* shader, bool useTime)
-        : m_mesh(mesh), m_shader(shader), m_useTime(useTime) {}
-    Object(Object&&) = default;
+    Object(Mesh mesh, Shader* shader, bool useTime, ObjectKinds kind);
+    Object(Object&& other) noexcept;//an added object stays in the render engine at its new address
     virtual ~Object() {}
-    void addToRenderEngine(Object3DRenderTypes renderType = Object3DRenderTypes::normal);
+    void addToRenderEngine(Object3DRenderTypes renderType = Object3DRenderTypes::normal);//does nothing when the object was already added with the same type
     void removeFromRenderEngine();
+    //a hidden object stays in the render engine but isn't drawn, e.g. a pooled object that isn't used
+    void setVisible(bool visible) {m_visible = visible;}
+    bool isVisible() const {return m_visible;}
+    ObjectKinds getKind() const {return m_kind;}
     void setModel(glm::mat4 model);
+    const Mesh& getMesh() const {return m_mesh;}
+    const Shader* getShader() const {return m_shader;}
+    virtual std::uint32_t getMaterialKey() const {return 0;}//the objects with the same key are sorted next to each other
     virtual void draw() const = 0;
 };
 
 class Object3D : public Object
 {
 protected:
+    Uniform<glm::mat4> m_modelUniform;//the camera is in the uniform block
     void configureShaders() const override;
+    Object3D(Mesh mesh, Shader* shader, bool useTime, ObjectKinds kind);
 public:
-    Object3D(Mesh mesh, Shader* shader, bool useTime = false)
-        : Object(mesh, shader, useTime) {}
+    Object3D(Mesh mesh, Shader* shader, bool useTime = false) : Object3D(mesh, shader, useTime, ObjectKinds::object3D) {}
 
     void draw() const override;
 };
 
-struct Material
+//the per-instance vertex attributes of the basic shader
+struct InstanceData
 {
-    glm::vec3 color {};
-    float ambientStrength {};
-    float shininess {};
-    float specularStrength {};
+    glm::mat4 model {};
+    Material material {};
 };
+static_assert(sizeof(InstanceData) == sizeof(glm::mat4) + 6 * sizeof(float), "InstanceData is uploaded as is");
 
+//drawn in instanced batches of the objects with the same mesh and shader. The shader has to read the model matrix and the material from the instance attributes like vBasic.glsl
 class LitObject : public Object3D
 {
 protected:
     Material m_material;
-    void configureShaders() const override;
 public:
+    static constexpr unsigned int INSTANCE_MODEL_LOCATION {2};//takes four locations, one per column
+    static constexpr unsigned int INSTANCE_COLOR_LOCATION {MATERIAL_COLOR_LOCATION};
+    static constexpr unsigned int INSTANCE_MATERIAL_LOCATION {MATERIAL_PROPERTIES_LOCATION};//unused when the mesh has the materials in its vertices
+
     LitObject(Mesh mesh, Shader* shader, const Material& material, bool useTime = false) 
-        : Object3D(mesh, shader, useTime), m_material(material) {}
+        : Object3D(mesh, shader, useTime, ObjectKinds::lit), m_material(material) {}
+    InstanceData getInstanceData() const {return {m_model, m_material};}
+    //draws the instances with the mesh, the shader and the shared uniforms of this object
+    void drawInstances(std::span<const InstanceData> instances) const;
     void draw() const override;
 };
 
@@ -76,9 +97,11 @@ public:
 class UnlitObject : public Object3D, public ColorSetterInterface
 {
 protected:
+    Uniform<glm::vec3> m_colorUniform;
     void configureShaders() const override;
 public:
     UnlitObject(Mesh mesh, glm::vec3 color, bool useTime = false);
+    std::uint32_t getMaterialKey() const override;
 
     void draw() const override;
 };
@@ -86,6 +109,8 @@ public:
 class Object2D : public Object, public ColorSetterInterface
 {
 protected:
+    Uniform<glm::vec3> m_colorUniform;
+    Uniform<glm::mat4> m_modelUniform;
     void configureShaders() const override; 
 public:
     Object2D(Mesh mesh, Shader* shader, glm::vec3 color, bool useTime = false);
@@ -99,6 +124,7 @@ class ObjectEntity
 {
 protected:
     std::vector<std::unique_ptr<Object>> m_objects;
+    bool m_visible {true};
 public:
     template<ObjectDelivered... UnitParts>
     ObjectEntity(UnitParts&&... args)
@@ -109,4 +135,6 @@ public:
     virtual ~ObjectEntity() {};
     void addToRenderEngine(Object3DRenderTypes renderType = Object3DRenderTypes::normal);
     void removeFromRenderEngine();
+    void setVisible(bool visible);
+    bool isVisible() const {return m_visible;}
 };
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include <engine/renderQueue.hpp>
+#include <engine/sampleHistory.hpp>
+
+enum class ProfileSections : std::uint8_t
+{
+    frame,
+    renderEngine,
+    gameController,
+    ui,
+    //the parts of RenderEngine::update, also measured on the GPU. In the order of RenderPasses
+    normalPass,
+    noDepthTestPass,
+    renderLastlyPass,
+    overlay2DPass,
+    callbacksPass,//the text and the other render callbacks
+    count
+};
+inline constexpr std::size_t PROFILE_SECTIONS_COUNT {static_cast<std::size_t>(ProfileSections::count)};
+inline constexpr std::array<const char*, PROFILE_SECTIONS_COUNT> PROFILE_SECTION_NAMES
+    {"frame", "RenderEngine::update", "GameController::update", "UI update", "normal pass", "no depth test pass", "render lastly pass", "2D pass", "render callbacks"};
+inline constexpr ProfileSections getPassSection(RenderPasses pass)
+{
+    return static_cast<ProfileSections>(static_cast<std::size_t>(ProfileSections::normalPass) + static_cast<std::size_t>(pass));
+}
+
+using ProfileStatistics = SampleStatistics;//in milliseconds over the last samples
+
+//the frame timings measured with scoped CPU timers and GL timer queries. Does nothing until it's enabled
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::size_t HISTORY_LENGTH {SampleHistory::LENGTH};
+private:
+    Profiler() = default;
+    ~Profiler() = default;
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler& other) = delete;
+
+    struct TraceEvent
+    {
+        ProfileSections section {};
+        bool gpu {};
+        std::int64_t start {}, duration {};//in microseconds since the profiler was enabled
+    };
+    //the results of the timer queries are read this many frames later so the CPU doesn't wait for the GPU
+    static constexpr std::size_t QUERY_FRAMES {4};
+    static constexpr std::size_t MAX_TRACE_EVENTS {1 << 20};
+    struct GpuQuery
+    {
+        unsigned int query {};
+        bool issued {};
+        Clock::time_point start;//placed on the trace at the time the CPU issued it
+    };
+
+    bool m_enabled {}, m_overlayEnabled {}, m_tracing {};
+    Clock::time_point m_startTime, m_frameStart;
+    std::array<SampleHistory, PROFILE_SECTIONS_COUNT> m_cpuHistories, m_gpuHistories;//the last samples of each section
+    std::array<std::array<GpuQuery, PROFILE_SECTIONS_COUNT>, QUERY_FRAMES> m_queries;
+    bool m_queriesCreated {};
+    std::size_t m_frame {};
+    std::optional<ProfileSections> m_gpuSection;//only one timer query can be active at a time
+    std::vector<TraceEvent> m_traceEvents;
+    std::int64_t getMicroseconds(Clock::time_point time) const;
+    void collectGpuQueries(std::size_t frame);
+public:
+    static Profiler& getInstance()
+    {
+        static Profiler instance;
+        return instance;
+    }
+    void setEnabled(bool enabled);
+    bool isEnabled() const {return m_enabled;}
+    void setOverlayEnabled(bool enabled);//enables the profiler too, which is disabled again with the overlay unless a trace runs
+    bool isOverlayEnabled() const {return m_overlayEnabled;}
+    void startTrace();//enables the profiler and records every sample until the trace is written
+    bool writeTrace(const std::string& path);//in the Chrome trace event format, e.g. for chrome://tracing or Perfetto
+
+    void beginFrame();//called once at the start of each frame
+    void addSample(ProfileSections section, Clock::time_point start, Clock::time_point end);
+    void beginGpuSection(ProfileSections section);
+    void endGpuSection();
+    ProfileStatistics getStatistics(ProfileSections section, bool gpu = false) const;
+    std::string getOverlayText() const;
+};
+
+//measures the CPU time until the end of the scope
+class ProfileScope
+{
+private:
+    ProfileSections m_section;
+    std::optional<Profiler::Clock::time_point> m_start;
+public:
+    explicit ProfileScope(ProfileSections section);
+    ~ProfileScope();
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
\ No newline at end of file
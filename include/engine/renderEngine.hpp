@@ -1,15 +1,24 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include <memory>
 #include <functional>
 #include <forward_list>
+#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
 
 #include <glm/glm.hpp>
 
+#include <engine/renderQueue.hpp>
+#include <engine/slotMap.hpp>
+
 class SceneLighting;
 class Object;
+class Shader;
 class Camera;
+struct InstanceData;
 
 enum class Object3DRenderTypes
 {
@@ -17,6 +26,27 @@ enum class Object3DRenderTypes
     noDepthTest,
     renderLastly
 };
+//decides where the object is kept in the RenderEngine. Set by the constructors so no casts are needed when it's added
+enum class ObjectKinds : std::uint8_t
+{
+    object2D,
+    object3D,
+    lit//drawn in instanced batches
+};
+
+struct RenderEntry
+{
+    const Object* object {};
+    std::uint32_t order {};//when the object was added. Used by the passes without the depth test
+};
+using RenderSlots = SlotMap<RenderEntry>;
+//returned when an object is added to the RenderEngine and used to remove it
+struct RenderHandle
+{
+    RenderSlots* slots {};//of the pass or the instance batch
+    SlotHandle slot;
+    bool isValid() const {return slots;}
+};
 
 class RenderEngine
 {
@@ -26,12 +56,40 @@ private:
     RenderEngine(const RenderEngine&) = delete;
     RenderEngine& operator=(const RenderEngine& other) = delete;
 
+    //the lit objects with the same mesh and shader, drawn with one instanced call. Kept when empty since the same units are usually added again
+    struct InstanceBatch
+    {
+        std::uint32_t order {};
+        RenderSlots objects;
+    };
+    using InstanceBatches = std::unordered_map<std::uint64_t, InstanceBatch>;//by the shader and the mesh
+    static constexpr std::size_t PASSES_COUNT {static_cast<std::size_t>(RenderPasses::count)};
+    struct Drawable
+    {
+        const Object* object {};
+        const InstanceBatch* batch {};//drawn instead of the object when set
+    };
+    static constexpr unsigned int UNKNOWN_BINDING {~0u};
+
     int m_width {}, m_height {};
-    std::vector<Object*> m_objects3DNormal, m_objects3DnoDepth, m_objects3Dlastl, m_objects2D;
+    //indexed by RenderPasses
+    std::array<RenderSlots, PASSES_COUNT> m_objects;
+    std::array<InstanceBatches, PASSES_COUNT> m_batches;
+    std::uint32_t m_nextOrder {};
+    std::vector<InstanceData> m_instanceData;//reused by every batch
+    RenderQueue m_renderQueue;
+    std::vector<Drawable> m_drawables;//indexed by the items of the queue
+    //the bound state is tracked to skip redundant changes. It's forgotten at the start of each frame since e.g. glText binds its own
+    unsigned int m_boundProgram {UNKNOWN_BINDING}, m_boundVAO {UNKNOWN_BINDING};
+    RenderStatistics m_statistics, m_lastStatistics;
+    unsigned int m_cameraBlockBuffer {}, m_lightingBlockBuffer {};
     Camera* m_camera {};
     glm::vec3 m_backgroundColor;
     std::unique_ptr<SceneLighting> m_lighting;
     std::forward_list<std::function<void()>> m_renderCallbacks;
+    void updateUniformBlocks();
+    void queueObjects(RenderPasses pass);
+    void drawBatch(const InstanceBatch& batch);
 public:
     static RenderEngine& getInstance()
     {
@@ -40,8 +98,9 @@ public:
     }
 
     void update();
-    void addObject(Object* obj, Object3DRenderTypes renderType = Object3DRenderTypes::normal);
-    void removeObject(Object* objPtr, Object3DRenderTypes renderType = Object3DRenderTypes::normal);
+    //O(1), the objects are usually added through Object::addToRenderEngine which keeps the handle
+    [[nodiscard]] RenderHandle addObject(const Object* object, Object3DRenderTypes renderType = Object3DRenderTypes::normal);
+    void removeObject(RenderHandle& handle);//invalidates the handle
     void setLighting(SceneLighting&& lighting);
     SceneLighting* getLighting() const;
     void setBackgroundColor(glm::vec3 color) {m_backgroundColor = color;}
@@ -51,4 +110,8 @@ public:
     glm::mat4 getProjection() const;
     glm::mat4 getView() const; 
     void onWindowResize(int width, int height);
+    void useProgram(unsigned int program);
+    void bindVertexArray(unsigned int VAO);
+    void countDraw(int instances = 1);
+    const RenderStatistics& getStatistics() const {return m_lastStatistics;}//of the last frame
 };
\ No newline at end of file
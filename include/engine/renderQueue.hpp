@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <span>
+
+//the passes in the order they are drawn
+enum class RenderPasses : std::uint8_t
+{
+    normal,
+    noDepthTest,
+    renderLastly,
+    overlay2D,
+    count
+};
+
+//the draws of a frame sorted by their keys. The key's bits from the most significant are the pass, the shader, the mesh and the material, so the draws sharing state end up next to each other
+class RenderQueue
+{
+public:
+    struct Item
+    {
+        std::uint64_t key {};
+        std::uint32_t index {};//of the drawable in the caller's list
+    };
+private:
+    static constexpr int PASS_SHIFT {60}, SHADER_SHIFT {48}, MESH_SHIFT {32};
+    std::vector<Item> m_items, m_buffer;
+public:
+    static std::uint64_t createKey(RenderPasses pass, unsigned int shader, unsigned int mesh, std::uint32_t material);
+    //keeps the submission order inside the pass, e.g. when the objects are drawn without the depth test
+    static std::uint64_t createOrderedKey(RenderPasses pass, std::uint32_t order);
+    static RenderPasses getPass(std::uint64_t key) {return static_cast<RenderPasses>(key >> PASS_SHIFT);}
+    void clear() {m_items.clear();}
+    void add(std::uint64_t key, std::uint32_t index) {m_items.push_back({key, index});}
+    void sort();//stable, so the draws with the same key keep their order
+    std::span<const Item> getItems() const {return m_items;}
+    std::size_t size() const {return m_items.size();}
+};
+
+//the work of the last frame, to see what the sorting saves
+struct RenderStatistics
+{
+    int draws {}, instances {};
+    int shaderChanges {}, meshChanges {}, depthTestChanges {};
+    int skippedChanges {};//binds of the shader or the mesh that was already bound
+};
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+//of the samples in a SampleHistory
+struct SampleStatistics
+{
+    float min {}, average {}, p50 {}, p95 {}, p99 {};
+    std::size_t samples {};
+};
+
+//the last samples of a measurement, e.g. the frame times, in a ring buffer
+class SampleHistory
+{
+public:
+    static constexpr std::size_t LENGTH {240};
+private:
+    std::array<float, LENGTH> m_samples {};
+    std::size_t m_count {}, m_next {};
+public:
+    void add(float sample);
+    std::size_t size() const {return m_count;}
+    float getAverage() const;//summed again each time, so the rounding errors don't build up like in a running sum
+    SampleStatistics getStatistics() const;//sorts a copy of the samples
+};
\ No newline at end of file
@@ -1,15 +1,56 @@
 #pragma once
 
+#include <string>
 #include <string_view>
+#include <unordered_map>
+#include <array>
+#include <cstddef>
 
 #include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+//a uniform location resolved when the shader was linked. Setting a uniform that isn't active in the shader does nothing
+template<typename T>
+class Uniform
+{
+private:
+    int m_location {-1};
+public:
+    Uniform() = default;
+    explicit Uniform(int location) : m_location(location) {}
+    bool isActive() const {return m_location != -1;}
+    void set(const T& value) const;
+};
+template<> inline void Uniform<int>::set(const int& value) const {glUniform1i(m_location, value);}
+template<> inline void Uniform<float>::set(const float& value) const {glUniform1f(m_location, value);}
+template<> inline void Uniform<glm::vec3>::set(const glm::vec3& value) const {glUniform3fv(m_location, 1, glm::value_ptr(value));}
+template<> inline void Uniform<glm::mat4>::set(const glm::mat4& value) const {glUniformMatrix4fv(m_location, 1, GL_FALSE, glm::value_ptr(value));}
+
+//the std140 uniform blocks shared by the shaders. They are updated once per frame by RenderEngine and bound to the index of the block
+enum class UniformBlocks
+{
+    camera,
+    lighting,
+    count
+};
+inline constexpr std::array<const char*, static_cast<std::size_t>(UniformBlocks::count)> UNIFORM_BLOCK_NAMES {"Camera", "Lighting"};
 
 class Shader
 {
 private:
     unsigned int m_id {};
+    std::unordered_map<std::string, int> m_uniformLocations;//every active uniform, e.g. "lights[0].color"
+    void resolveUniforms();//also binds the uniform blocks
 public:
     Shader(std::string_view vertexString, std::string_view fragmentString);
     auto getID() const {return m_id;}
-    void use() const {glUseProgram(m_id);}
+    void use() const;
+    //the lookup is done once, e.g. when an object is constructed, and the handle is used when drawing
+    template<typename T>
+    Uniform<T> getUniform(const std::string& name) const
+    {
+        auto location = m_uniformLocations.find(name);
+        return location == m_uniformLocations.end() ? Uniform<T>() : Uniform<T>(location->second);
+    }
 };
\ No newline at end of file
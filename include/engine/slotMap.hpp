@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#include <utility>
+
+//refers to an element of a SlotMap. Stays valid until the element is erased, even when the other elements move
+struct SlotHandle
+{
+    static constexpr std::uint32_t INVALID_INDEX {~0u};
+    std::uint32_t index {INVALID_INDEX};
+    std::uint32_t generation {};
+    bool isValid() const {return index != INVALID_INDEX;}
+};
+
+//the elements are contiguous for the iteration. Inserting and erasing are O(1) since the erased element is replaced by the last one, so the order isn't kept
+template<typename T>
+class SlotMap
+{
+private:
+    struct Slot
+    {
+        std::uint32_t dataIndex {};
+        std::uint32_t generation {};//changed when the element is erased so the old handles can be told apart
+    };
+    std::vector<T> m_data;
+    std::vector<std::uint32_t> m_dataSlots;//the slot of each element
+    std::vector<Slot> m_slots;
+    std::vector<std::uint32_t> m_freeSlots;
+public:
+    SlotHandle insert(T value)
+    {
+        std::uint32_t slotIndex {};
+        if(m_freeSlots.empty())
+        {
+            slotIndex = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        else
+        {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        Slot& slot = m_slots[slotIndex];
+        slot.dataIndex = static_cast<std::uint32_t>(m_data.size());
+        m_data.push_back(std::move(value));
+        m_dataSlots.push_back(slotIndex);
+        return {slotIndex, slot.generation};
+    }
+    void erase(SlotHandle handle)
+    {
+        assert(contains(handle) && "The element was already erased");
+        Slot& slot = m_slots[handle.index];
+        if(slot.dataIndex != m_data.size() - 1)
+        {
+            m_data[slot.dataIndex] = std::move(m_data.back());
+            m_dataSlots[slot.dataIndex] = m_dataSlots.back();
+            m_slots[m_dataSlots.back()].dataIndex = slot.dataIndex;
+        }
+        m_data.pop_back();
+        m_dataSlots.pop_back();
+        ++slot.generation;
+        m_freeSlots.push_back(handle.index);
+    }
+    bool contains(SlotHandle handle) const
+    {
+        return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+    }
+    T& operator[](SlotHandle handle)
+    {
+        assert(contains(handle));
+        return m_data[m_slots[handle.index].dataIndex];
+    }
+    const T& operator[](SlotHandle handle) const
+    {
+        assert(contains(handle));
+        return m_data[m_slots[handle.index].dataIndex];
+    }
+    auto begin() {return m_data.begin();}
+    auto end() {return m_data.end();}
+    auto begin() const {return m_data.begin();}
+    auto end() const {return m_data.end();}
+    std::size_t size() const {return m_data.size();}
+    bool empty() const {return m_data.empty();}
+};
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <engine/inplaceFunction.hpp>
+
+//large enough for the missile animation, the largest closure
+inline constexpr std::size_t UPDATE_FUNCTION_CAPACITY {192};
+//the return value is whether it's finished and the argument is the time step
+using UpdateFunction = InplaceFunction<bool(float), UPDATE_FUNCTION_CAPACITY>;
+
+//the updates run in this order within a step
+enum class UpdatePriorities : std::uint8_t
+{
+    early,
+    normal,
+    late
+};
+
+struct UpdateHandle
+{
+    std::uint32_t id {};
+    bool isValid() const {return id;}
+};
+
+//of the updates with the same name, in milliseconds
+struct UpdateStatistics
+{
+    std::string_view name;
+    std::size_t runs {};
+    float total {}, max {};
+};
+
+//runs the update functions each step. They are kept in a pool that is reused, so adding one doesn't allocate once the pool is large enough.
+//Adding and removing while the updates run take effect after the step. Doesn't depend on the window, so it can drive a simulation headlessly
+class UpdateScheduler
+{
+private:
+    using Clock = std::chrono::steady_clock;
+    struct Task
+    {
+        UpdateFunction function;
+        std::string_view name;
+        UpdatePriorities priority {};
+        std::uint32_t id {};//0 when the slot is free
+        bool removed {};
+    };
+    std::vector<Task> m_tasks;
+    std::vector<std::uint32_t> m_order;//the indices of the tasks in the order they run
+    std::vector<std::uint32_t> m_freeTasks;
+    std::vector<Task> m_pending;//added while the updates run
+    std::vector<UpdateStatistics> m_statistics;
+    std::uint32_t m_nextId {1};
+    bool m_running {}, m_changed {}, m_timing {};
+    double m_time {};
+    void insert(Task&& task);
+    void collect();
+    void addTime(std::string_view name, Clock::duration duration);
+public:
+    UpdateScheduler();
+    UpdateHandle add(UpdateFunction&& function, std::string_view name, UpdatePriorities priority = UpdatePriorities::normal);
+    void remove(UpdateHandle handle);
+    bool contains(UpdateHandle handle) const;
+    void run(float deltaTime);//one step of every update
+    bool empty() const {return m_order.empty() && m_pending.empty();}
+    double getTime() const {return m_time;}//the sum of the steps
+    void setTimingEnabled(bool enabled);//the statistics start over when it's enabled
+    const std::vector<UpdateStatistics>& getStatistics() const {return m_statistics;}
+};
\ No newline at end of file
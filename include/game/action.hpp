@@ -5,15 +5,13 @@
 #include <string_view>
 #include <string>
 #include <cstddef>
-#include <variant>
-#include <concepts>
 #include <functional>
-#include <unordered_set>
-#include <format>
 #include <cassert>
 
 #include <glm/glm.hpp>
 
+#include <core/units.hpp>
+
 inline constexpr char CURRENCY_SYMBOL = 'e';
 
 enum class ActionTypes
@@ -23,7 +21,6 @@ enum class ActionTypes
     nothing
 };
 
-class GameGrid;
 class Game;
 
 using SelectSquareCallback = std::function<float(Game*, std::size_t, std::size_t)>;
@@ -61,144 +58,55 @@ struct ActionData
     glm::vec3 color {};
     std::string_view infoText;
 };
+//the presentation of an action. The rules are applied by the match
 class Action
 {
 protected:
-    virtual ~Action() = default;
+    const ActionDefinition& m_definition;
+    const std::size_t m_actionIndex;
+    std::string m_name;
+    std::string m_infoText;
+    Action(UnitTypes unit, std::size_t actionIndex);
+    bool isUsable(Game* gameInstance) const;
 public:
+    virtual ~Action() = default;
     virtual ActionTypes use(Game* gameInstance) = 0;
-    virtual std::string_view getName() const = 0;
-    virtual glm::vec3 getColor(Game* gameInstance) const;
-    virtual std::string_view getInfoText() const {return "";}
+    std::string_view getName() const {return m_name;}
+    glm::vec3 getColor(Game* gameInstance) const;
+    std::string_view getInfoText() const {return m_infoText;}
+    static Action* get(UnitTypes unit, std::size_t actionIndex);
 };
 
-//abstract action classes
-enum class SelectOnGridTypes
+class SelectOnGridAction : public Action
 {
-    cross,
-    area,
-    selectEnemyUnit,
-};
-template<int Radius, SelectOnGridTypes SelectType, bool Blockable = false>
-class SelectOnGridAction : virtual public Action
-{
-    static_assert(!Blockable || SelectType != SelectOnGridTypes::selectEnemyUnit, "Unit selecting cannot be blockable");
 protected:
-    virtual bool isUsable(Game* gameInstance) const {return true;}
+    using Action::Action;
 public:
     ActionTypes use(Game* gameInstance) override final;
     virtual float callback(Game* gameInstance, std::size_t x, std::size_t y) = 0;
 };
-class ActionColorInterface : virtual public Action
-{
-private:
-    virtual bool isUsable(Game* gameInstance) const = 0;
-public:
-    glm::vec3 getColor(Game* gameInstance) const override final;
-};
-template<int Price>
-class BuyActionInterface : public ActionColorInterface
-{
-private:
-    mutable std::string m_buyActionName;
-protected:
-    virtual std::string_view getBuyActionName() const = 0;
-    void takeMoney(Game* gameInstance);
-    bool isUsable(Game* gameInstance) const override;
-public:
-    std::string_view getName() const override final;
-};
-template<int Price>
-class BuyAction : public BuyActionInterface<Price>
-{
-protected:
-    virtual void buy(Game* gameInstance) = 0;
-public:
-    ActionTypes use(Game* gameInstance) override final;
-};
-template<int Price, typename UpgradeClass>
-class UpgradeActionInterface : public BuyAction<Price>
-{
-    static constexpr std::string_view m_name = "UPGRADE";
-protected:
-    std::string_view getBuyActionName() const override {return m_name;}
-    void buy(Game* gameInstance) override;
-    virtual void upgrade(Game* gameInstance) {};
-};
-template<typename T>
-class SingletonAction
+//upgrading and selling
+class ImmediateAction final : public Action
 {
-protected:
-    SingletonAction() = default;
-    ~SingletonAction() = default;
 public:
-    static T* get()
-    {
-        static T t;
-        return &t;
-    }
+    ImmediateAction(UnitTypes unit, std::size_t actionIndex);
+    ActionTypes use(Game* gameInstance) override;
 };
-
-//actual actions
-template<int Radius, SelectOnGridTypes MoveType = SelectOnGridTypes::area>
-class MoveAction final : public SelectOnGridAction<Radius, MoveType, true>, public ActionColorInterface, public SingletonAction<MoveAction<Radius, MoveType>>
+class MoveAction final : public SelectOnGridAction
 {
-    static_assert(MoveType != SelectOnGridTypes::selectEnemyUnit);
-private:
-    static constexpr std::string_view m_name = "MOVE";
-protected:
-    bool isUsable(Game* gameInstance) const override;
 public:
-    std::string_view getName() const override {return m_name;}
+    MoveAction(UnitTypes unit, std::size_t actionIndex);
     float callback(Game* gameInstance, std::size_t x, std::size_t y) override;
 };
-template<int Worth>
-class SellAction final : public Action, public SingletonAction<SellAction<Worth>>
+class AttackAction final : public SelectOnGridAction
 {
-private:
-    const std::string m_name = std::format("SELL\n+{}{}", Worth, CURRENCY_SYMBOL);
-    static constexpr std::string_view m_infoText = "CEDE THE UNIT";
-public:
-    std::string_view getName() const override {return m_name;}
-    ActionTypes use(Game* gameInstance) override;
-    std::string_view getInfoText() const override {return m_infoText;}
-};
-template<int Price, typename UpgradeClass>
-class UpgradeAction final : public UpgradeActionInterface<Price, UpgradeClass>, public SingletonAction<UpgradeAction<Price, UpgradeClass>> 
-{};
-template<int Price, typename UpgradeClass, int NewMaxMoves, int NewTurnMoney>
-class BaseUpgradeAction final : public UpgradeActionInterface<Price, UpgradeClass>, public SingletonAction<BaseUpgradeAction<Price, UpgradeClass, NewMaxMoves, NewTurnMoney>> 
-{
-private:
-    std::string infoText = std::format("MOVES PER TURN: {}, MONEY PER TURN: {}{}", NewMaxMoves, NewTurnMoney, CURRENCY_SYMBOL);
-protected:
-    void upgrade(Game* gameInstance) override;
-    std::string_view getInfoText() const override {return infoText;}
-};
-class GridObject;
-template<int Price, int Radius, int Damage>
-class AttackAction final : public SelectOnGridAction<Radius, SelectOnGridTypes::selectEnemyUnit>, public BuyActionInterface<Price>, public SingletonAction<AttackAction<Price, Radius, Damage>>
-{
-private:
-    int m_usedTurn {};
-    mutable std::unordered_set<GridObject*> m_usedUnits;
-    static constexpr std::string_view m_name = "ATTACK";
-    static constexpr std::string_view m_infoText = "LAUNCH MISSILE (1 USE PER TURN)";
-protected:
-    std::string_view getBuyActionName() const override {return m_name;}
-    bool isUsable(Game* gameInstance) const override;
 public:
+    AttackAction(UnitTypes unit, std::size_t actionIndex);
     float callback(Game* gameInstance, std::size_t x, std::size_t y) override;
-    std::string_view getInfoText() const override {return m_infoText;}
 };
-template<int Price, int Radius, typename BuyUnit>
-class BuyUnitAction final : public SelectOnGridAction<Radius, SelectOnGridTypes::area, true>, public BuyActionInterface<Price>, public SingletonAction<BuyUnitAction<Price, Radius, BuyUnit>>
+class BuyUnitAction final : public SelectOnGridAction
 {
-private:
-    static constexpr std::string_view m_name = "BUY UNIT";
-protected:
-    std::string_view getBuyActionName() const override {return m_name;}
 public:
+    BuyUnitAction(UnitTypes unit, std::size_t actionIndex);
     float callback(Game* gameInstance, std::size_t x, std::size_t y) override;
-    std::string_view getInfoText() const override;
 };
\ No newline at end of file
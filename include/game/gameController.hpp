@@ -2,18 +2,23 @@
 
 #include <memory>
 #include <cstddef>
-#include <functional>
-#include <forward_list>
+#include <optional>
+#include <utility>
+#include <string_view>
+#include <vector>
+
+#include <core/units.hpp>
+#include <core/gameState.hpp>
+#include <core/replay.hpp>
+#include <engine/updateScheduler.hpp>
 
 class Object3D;
 class UIManager;
 class Game;
 class OrbitingCamera;
+class GameObject;
 enum class ButtonTypes;
 
-inline constexpr int GRID_SIZE = 16;
-static_assert(GRID_SIZE % 2 == 0);
-
 class GameController
 {
 private:
@@ -21,12 +26,21 @@ private:
     ~GameController();
     GameController(const GameController&) = delete;
     GameController& operator=(const GameController& other) = delete;
+    std::vector<GameObject*> m_interpolatedObjects;//declared before the game, so that its objects can remove themselves when it's destroyed
     std::unique_ptr<Game> m_currentGame;
     std::unique_ptr<Object3D> m_waterObj;
     std::unique_ptr<OrbitingCamera> m_camera;
-    std::forward_list<std::function<bool(float)>> m_updates;//return value is whether it should be removed and the argument is time
+    UpdateScheduler m_updates;
     bool m_hasGame {};
+    float m_timeScale {1.f}, m_stepTime {};//m_stepTime is the simulated time that isn't yet in a step
+    std::optional<std::pair<GameState, std::optional<Replay>>> m_startState;//the next game continues from the state
 public:
+    //written when a game is destroyed. The game is saved only when it isn't over
+    static constexpr const char* LAST_REPLAY_PATH = "last-game.ncreplay";
+    static constexpr const char* SAVED_GAME_PATH = "saved-game.ncsave";
+    //the update functions always advance by it, so the animations and the cooldowns don't depend on the frame rate
+    static constexpr float SIMULATION_STEP {1.f / 120.f};
+    static constexpr float MAX_FRAME_TIME {.25f};//a longer frame, e.g. when the window is dragged, is simulated as this long
     static GameController& getInstance()
     {
         static GameController instance;
@@ -34,9 +48,20 @@ public:
     }
 
     void update();
-    void addUpdateFunction(std::function<bool(float)>&& func);
-    void createGame();
+    void advanceSimulation(float time);//runs the steps of the time at once, e.g. to skip the animations when nothing is rendered
+    void setTimeScale(float timeScale) {m_timeScale = timeScale;}//the simulation runs this many times faster than real time
+    float getTimeScale() const {return m_timeScale;}
+    //the name groups the timings of the updates, e.g. in the profiler's overlay
+    UpdateHandle addUpdateFunction(UpdateFunction&& func, std::string_view name, UpdatePriorities priority = UpdatePriorities::normal);
+    void removeUpdateFunction(UpdateHandle handle);
+    const UpdateScheduler& getUpdateScheduler() const {return m_updates;}
+    //the rendered transforms of the objects are interpolated between the last two steps
+    void addInterpolatedObject(GameObject* object);
+    void removeInterpolatedObject(GameObject* object);
+    void createGame(bool aiOpponent = false);
     void destroyGame();
+    void setStartReplay(Replay replay, int turn);//the next game continues the replay from the start of the turn
+    void setStartState(const GameState& state);//the next game continues the state, e.g. a saved game
     bool hasGame();
     OrbitingCamera* getCamera() {return m_camera.get();}
     void receiveGameInput(std::size_t index, ButtonTypes buttonType);
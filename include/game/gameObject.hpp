@@ -1,6 +1,7 @@
 #pragma once
 
 #include <utility>
+#include <initializer_list>
 
 #include <glm/fwd.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -25,9 +26,10 @@ class GameObject : public ObjectEntity
 public:
     using GameObjectLight = std::pair<lights::PointLight, glm::vec3>;
 private:
-    Transform m_transform {};
+    Transform m_transform {}, m_previousTransform {};
     std::vector<GameObjectLight> m_lights;
-    void updateModelMatrix();
+    int m_interpolations {};//the animations moving the object
+    void updateModelMatrix(const Transform& transform);
 public:
     template<Object3DDelivered... ObjectParts>
     GameObject(std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
@@ -42,8 +44,14 @@ public:
     void setPosition(glm::vec3 position);
     void setRotation(glm::quat rotation);
     void setScale(glm::vec3 rotation);
+    void setVisible(bool visible);//the lights are turned off while it's hidden
     glm::vec3 getPosition() const {return m_transform.position;}
     const glm::quat& getRotation() const {return m_transform.rotation;}
+    //while an animation moves the object in the simulation steps, it's rendered between its transforms of the last two steps
+    void beginInterpolation();
+    void endInterpolation();
+    void storePreviousTransform() {m_previousTransform = m_transform;}
+    void interpolate(float ratio);
 };
 
 template<ObjectDelivered T, typename... Args, std::size_t V, std::size_t I>
@@ -59,4 +67,12 @@ T constructObject(const std::array<float, V>& vertices, const std::array<unsigne
     static ShaderManager& shaderManagerInstance = ShaderManager::getInstance();
     return T(meshManagerInstance.getMesh(vertices, indices, useNormals), shaderManagerInstance.getShader(vShader, fShader), 
         std::forward<Args>(args)...);
+}
+//the parts are merged into one mesh with their materials in the vertices, so a unit is drawn with one call. The mesh is created once per key
+inline LitObject constructMergedObject(int meshKey, std::initializer_list<MeshPart> parts, std::string_view vShader, std::string_view fShader)
+{
+    static MeshManager& meshManagerInstance = MeshManager::getInstance();
+    static ShaderManager& shaderManagerInstance = ShaderManager::getInstance();
+    return LitObject(meshManagerInstance.getMergedMesh(meshKey, std::span<const MeshPart>(parts.begin(), parts.size())),
+        shaderManagerInstance.getShader(vShader, fShader), Material {});
 }
\ No newline at end of file
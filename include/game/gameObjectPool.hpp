@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include <game/gameObject.hpp>
+
+//the short-lived objects, e.g. the effects of the actions
+enum class Prefabs : std::uint8_t
+{
+    missile,
+    count
+};
+inline constexpr std::size_t PREFABS_COUNT {static_cast<std::size_t>(Prefabs::count)};
+
+//refers to an object taken from a GameObjectPool until it's released
+struct PooledObject
+{
+    static constexpr std::uint32_t INVALID_INDEX {~0u};
+    Prefabs prefab {};
+    std::uint32_t index {INVALID_INDEX};
+    GameObject* object {};
+    bool isValid() const {return index != INVALID_INDEX;}
+    GameObject* operator->() const {return object;}
+};
+
+//the objects are constructed up front and stay in the render engine, hidden while they are free, so taking and releasing them
+//neither constructs objects nor changes the render lists. A prefab's pool grows only when all of its objects are in use
+class GameObjectPool
+{
+private:
+    GameObjectPool();
+    ~GameObjectPool() = default;
+    GameObjectPool(const GameObjectPool&) = delete;
+    GameObjectPool& operator=(const GameObjectPool& other) = delete;
+    struct Pool
+    {
+        std::vector<std::unique_ptr<GameObject>> objects;
+        std::vector<std::uint32_t> freeObjects;
+    };
+    std::array<Pool, PREFABS_COUNT> m_pools;
+    static std::unique_ptr<GameObject> createPrefab(Prefabs prefab);
+public:
+    static constexpr std::array<std::size_t, PREFABS_COUNT> INITIAL_COUNTS {4};//enough for the concurrent uses of a fast replay
+    static GameObjectPool& getInstance()
+    {
+        static GameObjectPool instance;
+        return instance;
+    }
+    void reserve(Prefabs prefab, std::size_t count);//constructs the objects until the pool has the count
+    [[nodiscard]] PooledObject acquire(Prefabs prefab);//shown at its last transform
+    void release(PooledObject& object);//hidden and returned to the pool, the handle becomes invalid
+    std::size_t getFreeCount(Prefabs prefab) const {return m_pools[static_cast<std::size_t>(prefab)].freeObjects.size();}
+};
\ No newline at end of file
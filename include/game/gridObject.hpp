@@ -1,94 +1,63 @@
 #pragma once
 
 #include <vector>
-#include <string_view>
+#include <memory>
 #include <cstddef>
 #include <utility>
-#include <concepts>
-#include <type_traits>
-#include <tuple>
 
 #include <game/gameObject.hpp>
 #include <game/action.hpp>
 #include <game/gameController.hpp>
+#include <core/units.hpp>
 
 class Game;
 class GridObject : public GameObject
 {
-public:
-    using is_large = std::false_type;
-    enum class Team
-    {
-        playerOne,
-        playerTwo,
-        neutral
-    };
 protected:
-    Team m_team {};
     template<Object3DDelivered... ObjectParts>
-    GridObject(Team team, std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
-        :  m_team(team), GameObject(std::move(lights), std::forward<ObjectParts>(parts)...)
+    GridObject(std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
+        : GameObject(std::move(lights), std::forward<ObjectParts>(parts)...)
     {
         setScale(glm::vec3(1.f / GRID_SIZE));
     }
     template<Object3DDelivered... ObjectParts>
-    GridObject(Team team, ObjectParts&&... parts)
-        :  GridObject(team, {}, std::forward<ObjectParts>(parts)...) {}
-public:
-    auto getTeam() const noexcept {return m_team;}
+    GridObject(ObjectParts&&... parts)
+        :  GridObject(std::vector<GameObjectLight> {}, std::forward<ObjectParts>(parts)...) {}
 };
 
+//the presentation of a unit. The rules of the unit are defined in core/units.hpp
 class UnitObject : public GridObject
 {
 private:
     std::vector<Action*> m_actions;
     std::vector<ActionData> m_actionData;
-    int m_maxHealth;
-    int m_health;
-    void initialize();
+    void initialize(UnitTypes type);
 protected:
     Game* m_gameInstance;
-    virtual void onDestroy() {}
 public:
     template<Object3DDelivered... ObjectParts>
-    UnitObject(Game* gameInstance, bool playerOne, int health, std::vector<Action*>&& actions, 
-        std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
-        : m_gameInstance(gameInstance), m_health(health), m_maxHealth(health), m_actions(std::move(actions)), 
-        GridObject(playerOne ? Team::playerOne : Team::playerTwo, std::move(lights), std::forward<ObjectParts>(parts)...)
+    UnitObject(Game* gameInstance, UnitTypes type, std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
+        : m_gameInstance(gameInstance), GridObject(std::move(lights), std::forward<ObjectParts>(parts)...)
     {
-        initialize();
+        initialize(type);
     }
     template<Object3DDelivered... ObjectParts>
-    UnitObject(Game* gameInstance, bool playerOne, int health, std::vector<Action*>&& actions, ObjectParts&&... parts)
-        : UnitObject(gameInstance, playerOne, health, std::move(actions), {}, std::forward<ObjectParts>(parts)...) {}
-    void addHealth(int health);
-    std::pair<int, int> getHealth();
-    void destroy();
+    UnitObject(Game* gameInstance, UnitTypes type, ObjectParts&&... parts)
+        : UnitObject(gameInstance, type, {}, std::forward<ObjectParts>(parts)...) {}
     ActionTypes useAction(std::size_t actionIndex);
     const std::vector<ActionData>& getActionData();
 };
-constexpr int BASE_HEALTH = 800;
-class BaseInterface : public UnitObject
-{
-protected:
-    template<Object3DDelivered... ObjectParts>
-    BaseInterface(Game* gameInstance, bool playerOne, std::vector<Action*>&& actions, std::vector<GameObjectLight>&& lights, ObjectParts&&... parts)
-        : UnitObject(gameInstance, playerOne, BASE_HEALTH, std::move(actions), std::move(lights), std::forward<ObjectParts>(parts)...) {}
-    void onDestroy() override;
-public:
-    using is_large = std::true_type;
-};
-class Base : public BaseInterface
+class Base : public UnitObject
 {
 public:
     Base(Game* game, bool playerOne);
 };
-class BaseUpgrade1 : public BaseInterface
+class BaseUpgrade1 : public UnitObject
 {
 public:
     BaseUpgrade1(Game* game, bool playerOne);
 };
-class BaseUpgrade2 : public BaseInterface
+class BaseUpgrade2 : public UnitObject
 {
 public:
     BaseUpgrade2(Game* game, bool playerOne);
@@ -119,39 +88,18 @@ class AircraftCarrierUpgrade1 : public UnitObject
 public:
     AircraftCarrierUpgrade1(Game* game, bool playerOne);
 };
-template<typename T>
-concept UnitDelivered = std::derived_from<T, UnitObject>;
-
-template<UnitDelivered T>
-constexpr std::string_view unitToString()
-{
-    if constexpr(std::is_same_v<T, SubmarineUnit>)
-        return "SUBMARINE";
-    else if constexpr(std::is_same_v<T, ShipUnit>)
-        return "SHIP";
-    else if constexpr(std::is_same_v<T, AircraftCarrierUnit>) 
-        return "AIRCRAFT CARRIER";
-    else return "";
-}
-template<typename T>
-constexpr bool isLargeGridObject()
-{
-    return std::is_same_v<typename T::is_large, std::true_type>;
-}
 
 class NeutralObject : public GridObject
 {
 public:
     template<Object3DDelivered... ObjectParts>
     NeutralObject(ObjectParts&&... parts)
-        : GridObject(Team::neutral, std::forward<ObjectParts>(parts)...) {}
+        : GridObject(std::forward<ObjectParts>(parts)...) {}
 };
 class IslandObject : public NeutralObject
 {
 public:
-    using is_large = std::true_type;
     IslandObject();
 };
 
-template<typename T>
-concept NeutralDelivered = std::derived_from<T, NeutralObject>;
+std::unique_ptr<GridObject> createGridObject(Game* gameInstance, UnitTypes type, Team team);
\ No newline at end of file
@@ -44,10 +44,12 @@ private:
     std::array<std::unique_ptr<ScalableButtonUIElement>, GAME_ACTION_BUTTONS_MAX_COUNT> m_gameActionButtons;
     std::unique_ptr<ButtonUIElement> m_endTurnButton;
     std::unique_ptr<TextUIElement> m_infoText, m_gameStatusText, m_gameMiddleText;
+    std::unique_ptr<TextUIElement> m_profilerText;//the frame timings, toggled with F3
     UIPreset* m_currentUI;
-    bool m_darkBackgroundEnabled {}, m_backButtonEnabled {};
+    bool m_darkBackgroundEnabled {}, m_aiOpponentEnabled {}, m_backButtonEnabled {};
     int m_enabledButtonsCount {};
     void changeCurrentUI(std::unique_ptr<UIPreset>& newUI);
+    void leaveGame();//back to the menu, a game in progress is saved
 public:
     static UIManager& getInstance()
     {
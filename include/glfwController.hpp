@@ -3,6 +3,8 @@
 #include <functional>
 #include <forward_list>
 
+#include <engine/framePacer.hpp>
+
 struct GLFWwindow;
 
 class GLFWController
@@ -13,9 +15,11 @@ private:
     GLFWController(const GLFWController&) = delete;
     GLFWController& operator=(const GLFWController& other) = delete;
     float m_deltaTime {};
-    double m_currentTime {}, m_lastTime {};
+    double m_currentTime {};
+    FramePacer m_framePacer;
     GLFWwindow* m_window;
     bool m_isMaximised {true};
+    bool m_idleRendering {}, m_redrawRequested {true};
     int m_width, m_height;
     std::forward_list<std::function<void(int)>> m_inputCallbacks;
 public:
@@ -24,7 +28,15 @@ public:
         static GLFWController instance;
         return instance;
     }
+    //an invisible window, or one of GLFW's null platform rendering with OSMesa when there is no display. Has to be set before the first getInstance
+    static void setHeadless(bool headless);
     void update();
+    //when nothing changes between the frames the loop blocks in waiting for events instead of rendering the same frame again
+    void setIdleRendering(bool enabled) {m_idleRendering = enabled;}
+    bool getIdleRendering() const {return m_idleRendering;}
+    void setFramePacing(FramePacingModes mode, float frameRate = FramePacer::DEFAULT_FRAME_RATE);
+    const FramePacer& getFramePacer() const {return m_framePacer;}
+    void requestRedraw() {m_redrawRequested = true;}//the next frame has to be rendered, e.g. an animation is running
     void maximize();
     void close();
     void terminate();
@@ -37,4 +49,6 @@ public:
     float getDeltaTime() {return m_deltaTime;}
     friend void inputCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
     friend void framebufferSizeCallback(GLFWwindow* window, int width, int height);
+    friend void windowRefreshCallback(GLFWwindow* window);
+    friend void windowFocusCallback(GLFWwindow* window, int focused);
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <utility>
+
+#include <core/distanceField.hpp>
+
+void DistanceField::compute(std::size_t origin, const Bitboard& obstacles)
+{
+    m_origin = origin;
+    m_reached.clear();
+    m_costs.fill(UNREACHABLE);
+
+    //every cell is pushed at most once per neighbour, so the queue never outgrows 8 entries per cell
+    using QueueEntry = std::pair<int, std::uint16_t>;
+    std::array<QueueEntry, GRID_SIZE * GRID_SIZE * 8 + 1> queue;
+    std::size_t queueSize {};
+    auto push = [&](int cost, std::size_t index)
+    {
+        queue[queueSize++] = std::make_pair(cost, static_cast<std::uint16_t>(index));
+        std::push_heap(queue.begin(), queue.begin() + queueSize, std::greater<> {});
+    };
+
+    m_costs[origin] = 0;
+    m_parents[origin] = static_cast<std::uint16_t>(origin);
+    m_firstSteps[origin] = static_cast<std::uint16_t>(origin);
+    push(0, origin);
+    while(queueSize)
+    {
+        std::pop_heap(queue.begin(), queue.begin() + queueSize, std::greater<> {});
+        auto [cost, currentIndex] = queue[--queueSize];
+        if(m_reached.test(currentIndex)) continue;//an outdated entry
+        m_reached.set(currentIndex);
+
+        static constexpr std::array<std::pair<int, int>, 8> directions =
+        {
+            std::make_pair(1, -1),
+            std::make_pair(1, 1),
+            std::make_pair(-1, 1),
+            std::make_pair(-1, -1),
+            std::make_pair(0, -1),
+            std::make_pair(0, 1),
+            std::make_pair(-1, 0),
+            std::make_pair(1, 0)
+        };
+        const int currentX = currentIndex % GRID_SIZE, currentY = currentIndex / GRID_SIZE;
+        for(auto dir : directions)
+        {
+            int neighbourX = currentX + dir.first, neighbourY = currentY + dir.second;
+            if(neighbourX < 0 || neighbourX >= GRID_SIZE || neighbourY < 0 || neighbourY >= GRID_SIZE)
+                continue;
+            std::size_t neighbourIndex = neighbourX + neighbourY * GRID_SIZE;
+            if(obstacles.test(neighbourIndex) || m_reached.test(neighbourIndex)) continue;
+
+            int newCost = cost + (dir.first && dir.second ? DIAGONAL_COST : STRAIGHT_COST);
+            if(newCost >= m_costs[neighbourIndex]) continue;
+            m_costs[neighbourIndex] = newCost;
+            m_parents[neighbourIndex] = currentIndex;
+            m_firstSteps[neighbourIndex] = currentIndex == origin ? static_cast<std::uint16_t>(neighbourIndex) : m_firstSteps[currentIndex];
+            push(newCost, neighbourIndex);
+        }
+    }
+}
+std::size_t DistanceField::getPathLength(std::size_t index) const
+{
+    if(!m_reached.test(index)) return 0;
+    std::size_t returnValue {1};
+    for(; index != m_origin; index = m_parents[index]) ++returnValue;
+    return returnValue;
+}
\ No newline at end of file
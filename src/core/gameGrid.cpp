@@ -0,0 +1,552 @@
+#include <array>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <iterator>
+
+#include <core/gameGrid.hpp>
+#include <core/zobrist.hpp>
+
+void GameGrid::updateMasks(std::size_t anchorIndex, bool value)
+{
+    ++m_generation;
+    m_hash ^= getCellKey(anchorIndex);
+    const GridCell& cell = m_base[anchorIndex];
+    bool large = getUnitDefinition(cell.type).large;
+    auto updateCell = [&](std::size_t index)
+    {
+        m_occupied.set(index, value);
+        m_teams[static_cast<std::size_t>(cell.team)].set(index, value);
+        m_types[static_cast<std::size_t>(cell.type)].set(index, value);
+        if(large) m_large.set(index, value);
+        m_anchors[index] = static_cast<std::uint16_t>(value ? anchorIndex : index);
+    };
+    updateCell(anchorIndex);
+    if(large)
+    {
+        updateCell(anchorIndex + 1);
+        updateCell(anchorIndex + GRID_SIZE);
+        updateCell(anchorIndex + 1 + GRID_SIZE);
+    }
+}
+std::uint64_t GameGrid::getCellKey(std::size_t anchorIndex) const
+{
+    const GridCell& cell = m_base[anchorIndex];
+    return getObjectKey(anchorIndex, cell.type, cell.team) ^ getHealthKey(anchorIndex, cell.health) ^ (cell.usedAttack ? getUsedAttackKey(anchorIndex) : 0);
+}
+const GridCell* GameGrid::initializeAt(UnitTypes type, std::size_t x, std::size_t y, Team team)
+{
+    const UnitDefinition& definition = getUnitDefinition(type);
+    if(definition.large)
+    {
+        if(x % 2 != 0)
+        {
+            if(x > 0) --x;
+            else ++x;
+        }
+        if(y % 2 != 0)
+        {
+            if(y > 0) --y;
+            else ++y;
+        }
+    }
+    std::size_t index = x + y * GRID_SIZE;
+    if(definition.large)
+    {
+        destroyAt(index);
+        destroyAt(index + 1);
+        destroyAt(index + GRID_SIZE);
+        destroyAt(index + 1 + GRID_SIZE);
+    }
+    else
+    {
+        assert(!m_large.test(index) && "Unable to initialize to a position with a base");
+        destroyAt(index);
+    }
+    m_base[index] = {type, team, false, definition.health};
+    updateMasks(index, true);
+    if(m_listener) m_listener->onGridObjectCreated(index, type, team);
+    return &m_base[index];
+}
+const GridCell* GameGrid::initializeAt(UnitTypes type, Loc loc, Team team)
+{
+    return initializeAt(type, loc.first, loc.second, team);
+}
+const GridCell* GameGrid::at(std::size_t x, std::size_t y) const
+{
+    return this->operator[](x + y * GRID_SIZE).first;
+}
+const GridCell* GameGrid::at(Loc loc) const
+{
+    return this->operator[](loc.first + loc.second * GRID_SIZE).first;
+}
+int GameGrid::addHealth(Loc loc, int health)
+{
+    std::size_t anchorIndex = m_anchors[convertLocationToIndex(loc)];
+    GridCell& cell = m_base[anchorIndex];
+    assert(cell.type != UnitTypes::none && "There has to be an object to change the health of");
+    m_hash ^= getCellKey(anchorIndex);
+    cell.health = std::min(cell.health + health, getUnitDefinition(cell.type).health);
+    m_hash ^= getCellKey(anchorIndex);
+    return cell.health;
+}
+void GameGrid::setUsedAttack(Loc loc, bool usedAttack)
+{
+    std::size_t anchorIndex = m_anchors[convertLocationToIndex(loc)];
+    GridCell& cell = m_base[anchorIndex];
+    assert(cell.type != UnitTypes::none);
+    m_hash ^= getCellKey(anchorIndex);
+    cell.usedAttack = usedAttack;
+    m_hash ^= getCellKey(anchorIndex);
+}
+void GameGrid::destroy(const GridCell* ptr)
+{
+    destroyAt(static_cast<std::size_t>(ptr - m_base.data()));
+}
+void GameGrid::destroyAt(Loc loc)
+{
+    destroyAt(loc.first + loc.second * GRID_SIZE);
+}
+void GameGrid::destroyAt(std::size_t index)
+{
+    if(!m_occupied.test(index)) return;
+    std::size_t objectIndex = m_anchors[index];
+    updateMasks(objectIndex, false);
+    m_base[objectIndex] = {};
+    if(m_listener) m_listener->onGridObjectDestroyed(objectIndex);
+}
+void GameGrid::moveAt(Loc loc1, Loc loc2)
+{
+    moveAlongPath({loc1, loc2});
+}
+const DistanceField& GameGrid::getDistanceField(Loc origin) const
+{
+    std::size_t originIndex = convertLocationToIndex(origin);
+    if(m_distanceFieldGeneration != m_generation || m_distanceField.getOrigin() != originIndex)
+    {
+        m_distanceField.compute(originIndex, m_occupied & ~getObjectMask(origin));
+        m_distanceFieldGeneration = m_generation;
+    }
+    return m_distanceField;
+}
+std::size_t GameGrid::findPathInDistanceField(std::size_t targetIndex, std::span<Loc> path) const
+{
+    std::size_t lastStepIndex = targetIndex;
+    //an occupied target is entered from its cheapest neighbour
+    if(!m_distanceField.isReachable(targetIndex))
+    {
+        int lowestCost = DistanceField::UNREACHABLE;
+        const int targetX = targetIndex % GRID_SIZE, targetY = targetIndex / GRID_SIZE;
+        for(int y = std::max(targetY - 1, 0); y <= std::min(targetY + 1, GRID_SIZE - 1); ++y)
+            for(int x = std::max(targetX - 1, 0); x <= std::min(targetX + 1, GRID_SIZE - 1); ++x)
+            {
+                std::size_t neighbourIndex = x + y * GRID_SIZE;
+                if(!m_distanceField.isReachable(neighbourIndex)) continue;
+                int cost = m_distanceField.getCost(neighbourIndex)
+                    + (x != targetX && y != targetY ? DistanceField::DIAGONAL_COST : DistanceField::STRAIGHT_COST);
+                if(cost < lowestCost)
+                {
+                    lowestCost = cost;
+                    lastStepIndex = neighbourIndex;
+                }
+            }
+        if(lastStepIndex == targetIndex) return 0;
+    }
+    std::size_t length = m_distanceField.getPathLength(lastStepIndex) + (lastStepIndex != targetIndex ? 1 : 0);
+    if(length > path.size()) return length;//the buffer is too small
+    std::size_t pathIndex = length;
+    if(lastStepIndex != targetIndex) path[--pathIndex] = convertIndexToLocation(targetIndex);
+    for(std::size_t i = lastStepIndex; ; i = m_distanceField.getParent(i))
+    {
+        path[--pathIndex] = convertIndexToLocation(i);
+        if(i == m_distanceField.getOrigin()) break;
+    }
+    return length;
+}
+std::size_t GameGrid::findPath(Loc startLoc, Loc moveLoc, std::span<Loc> path, bool avoidObstacles) const//A*
+{
+    const std::size_t startIndex = convertLocationToIndex(startLoc), endIndex = convertLocationToIndex(moveLoc);
+    if(startIndex == endIndex)
+    {
+        if(!path.empty()) path[0] = startLoc;
+        return 1;
+    }
+    //reuse the cached distance field when it's from the same origin. Large targets are left to A* as any of their cells can be entered
+    if(avoidObstacles && m_distanceFieldGeneration == m_generation && m_distanceField.getOrigin() == startIndex && !m_large.test(endIndex))
+        return findPathInDistanceField(endIndex, path);
+
+    static constexpr int MOVE_STRAIGHT_COST = 10;
+    static constexpr int MOVE_DIAGONAL_COST = 14;
+    auto calculateDistanceCost = [](std::size_t index1, std::size_t index2) -> int
+    {
+        int xDistance = std::abs(static_cast<int>(index1 % GRID_SIZE) - static_cast<int>(index2 % GRID_SIZE));
+        int yDistance = std::abs(static_cast<int>(index1 / GRID_SIZE) - static_cast<int>(index2 / GRID_SIZE));
+        return MOVE_DIAGONAL_COST * std::min(xDistance, yDistance) + MOVE_STRAIGHT_COST * std::abs(xDistance - yDistance);
+    };
+
+    //every node is written before it's read so the arrays don't need to be initialized
+    struct PathNode
+    {
+        int gCost;
+        int fCost;
+        std::uint16_t parentIndex;
+        std::uint16_t heapIndex;
+    };
+    std::array<PathNode, GRID_SIZE * GRID_SIZE> nodes;
+    std::array<std::uint16_t, GRID_SIZE * GRID_SIZE> heap;
+    std::size_t heapSize {};
+    Bitboard openedNodes, closedNodes;
+
+    //the open list is a binary heap of node indices ordered by fCost. Ties prefer the node closer to the target and then the smaller index, so the result is deterministic
+    auto isBefore = [&nodes, endIndex, &calculateDistanceCost](std::uint16_t lhs, std::uint16_t rhs) -> bool
+    {
+        if(nodes[lhs].fCost != nodes[rhs].fCost) return nodes[lhs].fCost < nodes[rhs].fCost;
+        int lhsHCost = nodes[lhs].fCost - nodes[lhs].gCost, rhsHCost = nodes[rhs].fCost - nodes[rhs].gCost;
+        if(lhsHCost != rhsHCost) return lhsHCost < rhsHCost;
+        return lhs < rhs;
+    };
+    auto place = [&](std::size_t heapIndex, std::uint16_t nodeIndex)
+    {
+        heap[heapIndex] = nodeIndex;
+        nodes[nodeIndex].heapIndex = static_cast<std::uint16_t>(heapIndex);
+    };
+    auto siftUp = [&](std::size_t heapIndex)
+    {
+        std::uint16_t nodeIndex = heap[heapIndex];
+        while(heapIndex > 0)
+        {
+            std::size_t parent = (heapIndex - 1) / 2;
+            if(!isBefore(nodeIndex, heap[parent])) break;
+            place(heapIndex, heap[parent]);
+            heapIndex = parent;
+        }
+        place(heapIndex, nodeIndex);
+    };
+    auto siftDown = [&](std::size_t heapIndex)
+    {
+        std::uint16_t nodeIndex = heap[heapIndex];
+        while(true)
+        {
+            std::size_t child = heapIndex * 2 + 1;
+            if(child >= heapSize) break;
+            if(child + 1 < heapSize && isBefore(heap[child + 1], heap[child])) ++child;
+            if(!isBefore(heap[child], nodeIndex)) break;
+            place(heapIndex, heap[child]);
+            heapIndex = child;
+        }
+        place(heapIndex, nodeIndex);
+    };
+
+    //the start and the target are not considered as obstacles
+    const Bitboard obstacles = avoidObstacles ? m_occupied & ~getObjectMask(startLoc) & ~getObjectMask(moveLoc) : Bitboard {};
+
+    nodes[startIndex] = {0, calculateDistanceCost(startIndex, endIndex), static_cast<std::uint16_t>(startIndex), 0};
+    openedNodes.set(startIndex);
+    heap[heapSize++] = static_cast<std::uint16_t>(startIndex);
+    while(heapSize)
+    {
+        std::uint16_t currentIndex = heap[0];
+        //found
+        if(currentIndex == endIndex)
+        {
+            std::size_t length {1};
+            for(std::size_t i = endIndex; i != startIndex; i = nodes[i].parentIndex) ++length;
+            if(length > path.size()) return length;//the buffer is too small
+            std::size_t pathIndex = length;
+            for(std::size_t i = endIndex; ; i = nodes[i].parentIndex)
+            {
+                path[--pathIndex] = convertIndexToLocation(i);
+                if(i == startIndex) break;
+            }
+            return length;
+        }
+        if(--heapSize)
+        {
+            place(0, heap[heapSize]);
+            siftDown(0);
+        }
+        closedNodes.set(currentIndex);
+
+        static constexpr std::array<std::pair<int, int>, 8> directions =
+        {
+            std::make_pair(1, -1),
+            std::make_pair(1, 1),
+            std::make_pair(-1, 1),
+            std::make_pair(-1, -1),
+            std::make_pair(0, -1),
+            std::make_pair(0, 1),
+            std::make_pair(-1, 0),
+            std::make_pair(1, 0)
+        };
+        const int currentX = currentIndex % GRID_SIZE, currentY = currentIndex / GRID_SIZE;
+        for(auto dir : directions)
+        {
+            int neighbourX = currentX + dir.first, neighbourY = currentY + dir.second;
+            if(neighbourX < 0 || neighbourX >= GRID_SIZE || neighbourY < 0 || neighbourY >= GRID_SIZE)
+                continue;
+            std::uint16_t neighbourIndex = static_cast<std::uint16_t>(neighbourX + neighbourY * GRID_SIZE);
+            if(obstacles.test(neighbourIndex) || closedNodes.test(neighbourIndex)) continue;
+
+            int tentativeGCost = nodes[currentIndex].gCost + (dir.first && dir.second ? MOVE_DIAGONAL_COST : MOVE_STRAIGHT_COST);
+            if(!openedNodes.test(neighbourIndex))
+            {
+                openedNodes.set(neighbourIndex);
+                nodes[neighbourIndex] = {tentativeGCost, tentativeGCost + calculateDistanceCost(neighbourIndex, endIndex), currentIndex, 0};
+                heap[heapSize] = neighbourIndex;
+                siftUp(heapSize++);
+            }
+            else if(tentativeGCost < nodes[neighbourIndex].gCost)
+            {
+                nodes[neighbourIndex].fCost += tentativeGCost - nodes[neighbourIndex].gCost;
+                nodes[neighbourIndex].gCost = tentativeGCost;
+                nodes[neighbourIndex].parentIndex = currentIndex;
+                siftUp(nodes[neighbourIndex].heapIndex);
+            }
+        }
+    }
+    //no path found
+    return 0;
+}
+GameGrid::Path GameGrid::findPath(Loc startLoc, Loc moveLoc, bool avoidObstacles) const
+{
+    PathBuffer buffer;
+    std::size_t length = findPath(startLoc, moveLoc, buffer, avoidObstacles);
+    return Path(buffer.begin(), buffer.begin() + length);
+}
+void GameGrid::moveAlongPath(const Path& path)
+{
+    std::size_t startIndex = convertLocationToIndex(path.front()), endIndex = convertLocationToIndex(path.back());
+    assert(m_base[startIndex].type != UnitTypes::none && "There has to be an object to be moved");
+    assert(!getUnitDefinition(m_base[startIndex].type).large && "Large objects cannot be moved");
+    if(startIndex == endIndex) return;
+    assert(!m_occupied.test(endIndex) && "Objects cannot be destroyed by moving");
+    updateMasks(startIndex, false);
+    m_base[endIndex] = m_base[startIndex];
+    m_base[startIndex] = {};
+    updateMasks(endIndex, true);
+    if(m_listener) m_listener->onGridObjectMoved(path);
+}
+const GameGrid::SelectableSquares& GameGrid::getSelectableSquares(Loc loc, int radius, SelectOnGridTypes selectType, bool blockable) const
+{
+    SelectableSquaresKey key {m_generation, convertLocationToIndex(loc), radius, selectType, blockable};
+    if(m_selectableSquaresKey != key)
+    {
+        computeSelectableSquares(loc, radius, selectType, blockable, m_selectableSquares);
+        m_selectableSquaresKey = key;
+    }
+    return m_selectableSquares;
+}
+void GameGrid::computeSelectableSquares(Loc indices, int radius, SelectOnGridTypes selectType, bool blockable, SelectableSquares& squares) const
+{
+    assert((!blockable || selectType != SelectOnGridTypes::selectEnemyUnit) && "Unit selecting cannot be blockable");
+    squares = {};
+    Bitboard& squaresToEnable = squares.squares;
+    squaresToEnable.set(convertLocationToIndex(indices));
+
+    static constexpr auto validLocIndex = [](int a) -> bool
+    {
+        return a < GRID_SIZE && a >= 0;
+    };
+    static constexpr std::array<std::pair<int, int>, 4> directions =
+    {
+        std::make_pair(1, -1),
+        std::make_pair(1, 1),
+        std::make_pair(-1, 1),
+        std::make_pair(-1, -1)
+    };
+
+    if(selectType != SelectOnGridTypes::selectEnemyUnit)
+    {
+        const std::size_t blockMaskN = radius * 2 - 2;
+        using BlockMask = std::pair<std::uint64_t, std::uint64_t>;
+        BlockMask blockMask {};
+        const bool hasBlockMask = blockable && selectType == SelectOnGridTypes::area;
+        Bitboard self;
+        if(blockable) self = getObjectMask(indices);
+        auto addDirection = [&](bool vertical)
+        {
+            Bitboard newIndices;
+            std::size_t processedIndex = vertical ? indices.first : indices.second;
+
+            std::size_t startIndex = static_cast<std::size_t>(std::max(static_cast<int>(processedIndex) - radius, 0));
+            std::size_t startIndexOffset {};
+            if(startIndex == 0) startIndexOffset = std::abs(static_cast<int>(processedIndex) - radius);
+            std::size_t maxIndex = processedIndex + radius + 1;
+            auto targetIndex = std::min(static_cast<std::size_t>(GRID_SIZE), maxIndex);
+            for(std::size_t i = startIndex; i < targetIndex; ++i)
+            {
+                if(i == processedIndex) continue;
+                Loc currentPos(vertical ? i : indices.first, vertical ? indices.second : i);
+                std::size_t currentIndex = convertLocationToIndex(currentPos);
+                if(m_occupied.test(currentIndex))
+                {
+                    if(!blockable) continue;
+                    if(self.test(currentIndex)) continue;
+                    if(i < processedIndex)
+                    {
+                        if(hasBlockMask)
+                        {
+                            if(vertical) blockMask.first |= (1ull << (startIndexOffset + i - startIndex)) - 1;
+                            else blockMask.second |= (1ull << (startIndexOffset + i - startIndex)) - 1;
+                        }
+                        newIndices.clear();
+                        continue;
+                    }
+                    if(hasBlockMask)
+                    {
+                        if(vertical) blockMask.first |= ((1ull << (maxIndex - 1 - i)) - 1) << (blockMaskN / 2 + i - processedIndex - 1);
+                        else blockMask.second |= ((1ull << (maxIndex - 1 - i)) - 1) << (blockMaskN / 2 + i - processedIndex - 1);
+                    }
+                    break;
+                }
+                newIndices.set(currentIndex);
+            }
+            squaresToEnable |= newIndices;
+        };
+        auto addArea = [&]()
+        {
+            for(auto dir : directions)
+            {
+                //this lambda should not affect the blocking elsewhere hence the copied blockmask
+                BlockMask areaBlockMask = blockMask;
+                auto tryAddPosition = [&](std::size_t x, std::size_t y, std::size_t blockMaskX, std::size_t blockMaskY)
+                {
+                    std::size_t currentIndex = x + y * GRID_SIZE;
+                    if(blockable)
+                    {
+                        if(m_occupied.test(currentIndex))
+                        {
+                            if(self.test(currentIndex)) return;
+                            areaBlockMask.first |= 1ull << blockMaskX;
+                            areaBlockMask.second |= 1ull << blockMaskY;
+                            return;
+                        }
+                        if(!(areaBlockMask.first >> blockMaskX & 1ull)
+                            || !(areaBlockMask.second >> blockMaskY & 1ull))
+                            squaresToEnable.set(currentIndex);
+                    }
+                    else
+                    {
+                        if(!m_occupied.test(currentIndex))
+                            squaresToEnable.set(currentIndex);
+                    }
+                };
+                for(int length {radius - 1}, offsetX {dir.first}, offsetY {dir.second};
+                    length >= 1; length -= 2, offsetX += dir.first, offsetY += dir.second)
+                {
+                    int x = indices.first + offsetX;
+                    int y = indices.second + offsetY;
+                    if(!validLocIndex(x) || !validLocIndex(y)) break;
+                    std::size_t blockMaskX = radius + offsetX + (offsetX < 0 ? -1 : -2);
+                    std::size_t blockMaskY = radius + offsetY + (offsetY < 0 ? -1 : -2);
+                    tryAddPosition(x, y, blockMaskX, blockMaskY);
+                    for(int i {1}; i < length; ++i)
+                    {
+                        int newX = x + (dir.first == 1 ? i : -i);
+                        int newY = y + (dir.second == 1 ? i : -i);
+                        bool validX = validLocIndex(newX), validY = validLocIndex(newY);
+
+                        std::size_t newBlockMaskX = blockMaskX + (dir.first == 1 ? i : -i);
+                        std::size_t newBlockMaskY = blockMaskY + (dir.second == 1 ? i : -i);
+
+                        if(!validX && !validY) break;
+                        if(validX)
+                            tryAddPosition(newX, y, newBlockMaskX, blockMaskY);
+                        if(validY)
+                            tryAddPosition(x, newY, blockMaskX, newBlockMaskY);
+                    }
+                }
+            }
+        };
+        addDirection(true);
+        addDirection(false);
+        if(selectType == SelectOnGridTypes::area) addArea();
+    }
+    else //select enemy unit logic
+    {
+        const Bitboard& targets = getTeamMask(at(indices)->team == Team::playerOne ? Team::playerTwo : Team::playerOne);
+        auto tryAddPosition = [&](std::size_t x, std::size_t y)
+        {
+            std::size_t index = x + y * GRID_SIZE;
+            squaresToEnable.set(index);
+            if(!targets.test(index)) squares.nonInteractable.set(index);
+        };
+        auto addDirection = [&](bool vertical)
+        {
+            std::size_t processedIndex = vertical ? indices.first : indices.second;
+
+            std::size_t i = static_cast<std::size_t>(std::max(static_cast<int>(processedIndex) - radius, 0));
+            auto targetIndex = std::min(static_cast<std::size_t>(GRID_SIZE), processedIndex + radius + 1);
+            for(; i < targetIndex; ++i)
+            {
+                if(i != processedIndex)
+                    tryAddPosition(vertical ? i : indices.first, vertical ? indices.second : i);
+            }
+        };
+        auto addArea = [&]()
+        {
+            for(auto dir : directions)
+            {
+                for(int length {radius - 1}, offsetX {dir.first}, offsetY {dir.second};
+                    length >= 1; length -= 2, offsetX += dir.first, offsetY += dir.second)
+                {
+                    int x = indices.first + offsetX;
+                    int y = indices.second + offsetY;
+                    if(!validLocIndex(x) || !validLocIndex(y)) break;
+
+                    tryAddPosition(x, y);
+                    for(int i {1}; i < length; ++i)
+                    {
+                        int newX = x + (dir.first == 1 ? i : -i);
+                        int newY = y + (dir.second == 1 ? i : -i);
+                        bool validX = validLocIndex(newX), validY = validLocIndex(newY);
+                        if(!validX && !validY) break;
+                        if(validX)
+                            tryAddPosition(newX, y);
+                        if(validY)
+                            tryAddPosition(x, newY);
+                    }
+                }
+            }
+        };
+        addDirection(true);
+        addDirection(false);
+        addArea();
+    }
+}
+Bitboard GameGrid::getObjectMask(Loc loc) const
+{
+    Bitboard returnValue;
+    std::size_t index = convertLocationToIndex(loc);
+    if(!m_occupied.test(index)) return returnValue;
+    if(!m_large.test(index))
+    {
+        returnValue.set(index);
+        return returnValue;
+    }
+    std::size_t anchorIndex = m_anchors[index];
+    returnValue.set(anchorIndex);
+    returnValue.set(anchorIndex + 1);
+    returnValue.set(anchorIndex + GRID_SIZE);
+    returnValue.set(anchorIndex + 1 + GRID_SIZE);
+    return returnValue;
+}
+std::pair<const GridCell*, std::size_t> GameGrid::operator[](std::size_t index) const
+{
+    if(!m_occupied.test(index)) return std::make_pair(nullptr, index);
+    if(!m_large.test(index)) return std::make_pair(&m_base[index], index);
+    //the corrected index of a large object is the cell of the anchor row that faces the center
+    std::size_t anchorIndex = m_anchors[index];
+    bool reverseX = anchorIndex % GRID_SIZE < GRID_SIZE / 2;
+    return std::make_pair(&m_base[anchorIndex], anchorIndex + (reverseX ? 1 : 0));
+}
+GameGrid::Loc GameGrid::convertIndexToLocation(std::size_t index)
+{
+    return std::make_pair(index % GRID_SIZE, index / GRID_SIZE);
+}
+std::size_t GameGrid::convertLocationToIndex(Loc loc)
+{
+    return loc.first + loc.second * GRID_SIZE;
+}
\ No newline at end of file
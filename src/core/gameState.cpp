@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cassert>
+
+#include <core/gameState.hpp>
+#include <core/gameGrid.hpp>
+
+std::size_t GameState::getObjectIndex(std::size_t index) const
+{
+    if(cells[index].type != UnitTypes::none) return index;
+    //large objects are at even coordinates
+    std::size_t anchorIndex = (index % GRID_SIZE & ~std::size_t {1}) + (index / GRID_SIZE & ~std::size_t {1}) * GRID_SIZE;
+    if(cells[anchorIndex].type != UnitTypes::none && getUnitDefinition(cells[anchorIndex].type).large) return anchorIndex;
+    return index;
+}
+GameState::Undo GameState::makeMove(const Decision& decision)
+{
+    Undo undo {.usedAttacks = usedAttacks, .playerOne = playerOne, .playerTwo = playerTwo,
+        .turnNumber = turnNumber, .playerOneToPlay = playerOneToPlay, .gameOver = gameOver, .random = random};
+    auto changeCell = [&](std::size_t index, StateCell cell)
+    {
+        assert(undo.changedCellCount < undo.changedCells.size());
+        undo.changedCells[undo.changedCellCount++] = {static_cast<std::uint16_t>(index), cells[index]};
+        cells[index] = cell;
+    };
+
+    if(decision.endTurn)
+    {
+        ++turnNumber;
+        PlayerData& playerData = currentPlayerData();
+        playerData.moves = playerData.maxMoves;
+        playerData.money += playerData.turnMoney;
+        playerOneToPlay = !playerOneToPlay;
+        usedAttacks.clear();
+        return undo;
+    }
+
+    const std::size_t unitIndex = getObjectIndex(GameGrid::convertLocationToIndex(decision.unit));
+    const StateCell unit = cells[unitIndex];
+    assert(unit.type != UnitTypes::none && unit.team == (playerOneToPlay ? Team::playerOne : Team::playerTwo));
+    const ActionDefinition& action = getUnitDefinition(unit.type).actions[decision.actionIndex];
+    PlayerData& playerData = currentPlayerData();
+    switch(action.kind)
+    {
+        using enum ActionKinds;
+    case move:
+    {
+        std::size_t targetIndex = GameGrid::convertLocationToIndex(decision.target.value());
+        --playerData.moves;
+        changeCell(targetIndex, unit);
+        changeCell(unitIndex, {});
+        usedAttacks.set(targetIndex, usedAttacks.test(unitIndex));
+        usedAttacks.reset(unitIndex);
+        break;
+    }
+    case attack:
+    {
+        usedAttacks.set(unitIndex);
+        playerData.money -= action.price;
+        std::size_t targetIndex = getObjectIndex(GameGrid::convertLocationToIndex(decision.target.value()));
+        StateCell target = cells[targetIndex];
+        assert(target.type != UnitTypes::none);
+        int health = std::min(target.health + random.get<int>(-action.damage + DAMAGE_SPREAD, -action.damage - DAMAGE_SPREAD), getUnitDefinition(target.type).health);
+        if(health > 0)
+        {
+            target.health = static_cast<std::int16_t>(health);
+            changeCell(targetIndex, target);
+            break;
+        }
+        changeCell(targetIndex, {});
+        usedAttacks.reset(targetIndex);
+        if(isBase(target.type)) gameOver = true;
+        break;
+    }
+    case buyUnit:
+        playerData.money -= action.price;
+        changeCell(GameGrid::convertLocationToIndex(decision.target.value()),
+            {action.unit, unit.team, static_cast<std::int16_t>(getUnitDefinition(action.unit).health)});
+        break;
+    case upgrade:
+        playerData.money -= action.price;
+        changeCell(unitIndex, {action.unit, unit.team, static_cast<std::int16_t>(getUnitDefinition(action.unit).health)});
+        usedAttacks.reset(unitIndex);
+        if(action.newMaxMoves)
+        {
+            playerData.maxMoves = action.newMaxMoves;
+            playerData.turnMoney = action.newTurnMoney;
+        }
+        break;
+    case sell:
+        playerData.money += action.worth;
+        changeCell(unitIndex, {});
+        usedAttacks.reset(unitIndex);
+        break;
+    }
+    return undo;
+}
+void GameState::unmakeMove(const Undo& undo)
+{
+    for(std::size_t i = undo.changedCellCount; i-- > 0;)
+        cells[undo.changedCells[i].index] = undo.changedCells[i].cell;
+    usedAttacks = undo.usedAttacks;
+    playerOne = undo.playerOne;
+    playerTwo = undo.playerTwo;
+    turnNumber = undo.turnNumber;
+    playerOneToPlay = undo.playerOneToPlay;
+    gameOver = undo.gameOver;
+    random = undo.random;
+}
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include <cassert>
+#include <vector>
+#include <cstdint>
+
+#include <core/match.hpp>
+#include <core/gameState.hpp>
+#include <core/zobrist.hpp>
+
+Match::Match(MatchListener* listener, std::uint64_t seed) : m_grid(listener), m_listener(listener), m_seed(seed), m_random(seed)
+{
+    auto basesRandomSeed = m_random.get<std::size_t>(2, (GRID_SIZE - 4) / 2) * 2;
+    m_grid.initializeAt(UnitTypes::base, 0, basesRandomSeed, Team::playerOne);
+    int otherBaseY = (GRID_SIZE - 2) - basesRandomSeed;
+    m_grid.initializeAt(UnitTypes::base, GRID_SIZE - 2, otherBaseY, Team::playerTwo);
+    m_grid.initializeAt(UnitTypes::submarine, GRID_SIZE - 3, otherBaseY + 1, Team::playerTwo);
+
+    //generate islands
+    std::vector<Loc> validIslandIndices;
+    for(std::size_t x = 2; x < GRID_SIZE - 2; x += 2)//When there are no islands in the same column as the bases and not enough islands to fill a column, it is guaranteed that the path from base to another is not blocked.
+        for(std::size_t y {}; y < GRID_SIZE; y += 2)
+            {
+                if(!m_grid.at(x, y) && !m_grid.at(x + 1, y) && !m_grid.at(x, y + 1) && !m_grid.at(x + 1, y + 1))
+                    validIslandIndices.push_back(std::make_pair(x, y));
+            }
+    static constexpr std::size_t ISLAND_COUNT = 7;
+    static_assert(GRID_SIZE / 2 > ISLAND_COUNT);
+    assert(ISLAND_COUNT <= validIslandIndices.size());
+    for(std::size_t initializedIslands {}; initializedIslands != ISLAND_COUNT; ++initializedIslands)
+    {
+        auto islandIndex = m_random.get<std::size_t>(0, validIslandIndices.size() - 1);
+        m_grid.initializeAt(UnitTypes::island, validIslandIndices[islandIndex]);
+        validIslandIndices.erase(validIslandIndices.begin() + islandIndex);
+    }
+}
+void Match::setListener(MatchListener* listener)
+{
+    m_listener = listener;
+    m_grid.setListener(listener);
+}
+GameState Match::getState() const
+{
+    GameState returnValue {.playerOne = m_playerData.first, .playerTwo = m_playerData.second, .turnNumber = m_turnNumber,
+        .playerOneToPlay = m_playerOneToPlay, .gameOver = m_gameOver, .random = m_random};
+    m_grid.getOccupied().forEach([&](std::size_t index)
+    {
+        const GridCell* cell = m_grid[index].first;
+        if(m_grid.getAnchorIndex(cell) != index) return;
+        returnValue.cells[index] = {cell->type, cell->team, static_cast<std::int16_t>(cell->health)};
+        returnValue.usedAttacks.set(index, cell->usedAttack);
+    });
+    return returnValue;
+}
+void Match::setState(const GameState& state)
+{
+    Bitboard occupied = m_grid.getOccupied();
+    occupied.forEach([this](std::size_t index)
+    {
+        m_grid.destroyAt(index);
+    });
+    for(std::size_t index {}; index < state.cells.size(); ++index)
+    {
+        const StateCell& stateCell = state.cells[index];
+        if(stateCell.type == UnitTypes::none) continue;
+        Loc loc = GameGrid::convertIndexToLocation(index);
+        const GridCell* cell = m_grid.initializeAt(stateCell.type, loc, stateCell.team);
+        m_grid.addHealth(loc, stateCell.health - cell->health);
+        m_grid.setUsedAttack(loc, state.usedAttacks.test(index));
+    }
+    m_playerData = std::make_pair(state.playerOne, state.playerTwo);
+    m_turnNumber = state.turnNumber;
+    m_playerOneToPlay = state.playerOneToPlay;
+    m_gameOver = state.gameOver;
+    m_random = state.random;
+}
+std::uint64_t Match::getHash() const
+{
+    auto getKey = [](bool playerOne, const PlayerData& playerData)
+    {
+        return getPlayerKey(playerOne, playerData.money, playerData.moves, playerData.maxMoves, playerData.turnMoney);
+    };
+    return m_grid.getHash() ^ getKey(true, m_playerData.first) ^ getKey(false, m_playerData.second) ^ (m_playerOneToPlay ? 0 : PLAYER_TWO_TO_PLAY_KEY);
+}
+int Match::getMoney() const
+{
+    return m_playerOneToPlay ? m_playerData.first.money : m_playerData.second.money;
+}
+void Match::addMoney(int money)
+{
+    currentPlayerData().money += money;
+}
+void Match::setTurnData(int maxMoves, int money)
+{
+    auto& playerData = currentPlayerData();
+    playerData.maxMoves = maxMoves;
+    playerData.turnMoney = money;
+}
+void Match::takeMove()
+{
+    --currentPlayerData().moves;
+}
+bool Match::canMove() const
+{
+    if(m_playerOneToPlay) return m_playerData.first.moves;
+    else return m_playerData.second.moves;
+}
+void Match::endTurn()
+{
+    ++m_turnNumber;
+    auto& playerData = currentPlayerData();
+    playerData.moves = playerData.maxMoves;
+    playerData.money += playerData.turnMoney;
+    m_playerOneToPlay = !m_playerOneToPlay;
+
+    //attacks can be used once per turn
+    (m_grid.getTeamMask(Team::playerOne) | m_grid.getTeamMask(Team::playerTwo)).forEach([this](std::size_t index)
+    {
+        m_grid.setUsedAttack(GameGrid::convertIndexToLocation(index), false);
+    });
+}
+bool Match::isActionUsable(Loc unitLoc, std::size_t actionIndex) const
+{
+    const GridCell* unit = m_grid.at(unitLoc);
+    assert(unit && "There has to be a unit to use an action");
+    const UnitDefinition& definition = getUnitDefinition(unit->type);
+    assert(actionIndex < definition.actionsCount);
+    const ActionDefinition& action = definition.actions[actionIndex];
+    switch(action.kind)
+    {
+        using enum ActionKinds;
+    case move:
+        return canMove();
+    case attack:
+        return !unit->usedAttack && getMoney() >= action.price;
+    case buyUnit:
+    case upgrade:
+        return getMoney() >= action.price;
+    case sell:
+        return true;
+    }
+    return false;
+}
+bool Match::requiresTarget(Loc unitLoc, std::size_t actionIndex) const
+{
+    auto kind = getUnitDefinition(m_grid.at(unitLoc)->type).actions[actionIndex].kind;
+    return kind == ActionKinds::move || kind == ActionKinds::attack || kind == ActionKinds::buyUnit;
+}
+GameGrid::SelectableSquares Match::getActionSquares(Loc unitLoc, std::size_t actionIndex) const
+{
+    assert(requiresTarget(unitLoc, actionIndex));
+    const ActionDefinition& action = getUnitDefinition(m_grid.at(unitLoc)->type).actions[actionIndex];
+    //moving and buying units are blocked by other objects
+    auto returnValue = m_grid.getSelectableSquares(unitLoc, action.radius, action.selectType, action.kind != ActionKinds::attack);
+    //squares enclosed by other objects are shown but cannot be moved to
+    if(action.kind == ActionKinds::move) returnValue.nonInteractable |= returnValue.squares & ~m_grid.getDistanceField(unitLoc).getReached();
+    return returnValue;
+}
+bool Match::isValidTarget(Loc unitLoc, std::size_t actionIndex, Loc target) const
+{
+    if(target == unitLoc || m_grid.at(target) == m_grid.at(unitLoc)) return false;
+    const ActionDefinition& action = getUnitDefinition(m_grid.at(unitLoc)->type).actions[actionIndex];
+    const auto& squares = m_grid.getSelectableSquares(unitLoc, action.radius, action.selectType, action.kind != ActionKinds::attack);
+    std::size_t targetIndex = GameGrid::convertLocationToIndex(target);
+    if(!squares.squares.test(targetIndex) || squares.nonInteractable.test(targetIndex)) return false;
+    //only a move needs the distance field, which its path reuses
+    return action.kind != ActionKinds::move || m_grid.getDistanceField(unitLoc).isReachable(targetIndex);
+}
+void Match::applyDamage(Loc target, int damage)
+{
+    const GridCell* hitCell = m_grid.at(target);
+    assert(hitCell);
+    if(m_grid.addHealth(target, m_random.get<int>(-damage + DAMAGE_SPREAD, -damage - DAMAGE_SPREAD)) > 0) return;
+
+    //end game
+    bool baseDestroyed = isBase(hitCell->type);
+    Team team = hitCell->team;
+    m_grid.destroy(hitCell);
+    if(baseDestroyed)
+    {
+        m_gameOver = true;
+        if(m_listener) m_listener->onGameOver(team != Team::playerOne);
+    }
+}
+ActionResult Match::useAction(Loc unitLoc, std::size_t actionIndex, std::optional<Loc> target)
+{
+    if(m_gameOver || !isActionUsable(unitLoc, actionIndex)) return {};
+    assert(requiresTarget(unitLoc, actionIndex) == target.has_value());
+    assert(!target || isValidTarget(unitLoc, actionIndex, target.value()));
+
+    const GridCell* unit = m_grid.at(unitLoc);
+    const ActionDefinition& action = getUnitDefinition(unit->type).actions[actionIndex];
+    ActionResult result {true};
+    switch(action.kind)
+    {
+        using enum ActionKinds;
+    case move:
+        result.path = m_grid.findPath(unitLoc, target.value());//uses the distance field of the move preview
+        if(result.path.empty()) return {};//the target is surrounded by obstacles
+        takeMove();
+        m_grid.moveAlongPath(result.path);
+        break;
+    case attack:
+        m_grid.setUsedAttack(unitLoc, true);
+        addMoney(-action.price);
+        applyDamage(target.value(), action.damage);
+        break;
+    case buyUnit:
+        addMoney(-action.price);
+        m_grid.initializeAt(action.unit, target.value(), unit->team);
+        result.path = m_grid.findPath(unitLoc, target.value());
+        break;
+    case upgrade:
+        addMoney(-action.price);
+        m_grid.initializeAt(action.unit, unitLoc, unit->team);
+        if(action.newMaxMoves) setTurnData(action.newMaxMoves, action.newTurnMoney);
+        break;
+    case sell:
+        addMoney(action.worth);
+        m_grid.destroyAt(unitLoc);
+        break;
+    }
+    assert(getMoney() >= 0);
+    return result;
+}
+void Match::getLegalDecisions(std::vector<Decision>& decisions) const
+{
+    decisions.clear();
+    decisions.push_back({true});
+    if(m_gameOver) return;
+    m_grid.getTeamMask(getCurrentTeam()).forEach([&](std::size_t index)
+    {
+        //large objects are used from their corrected index like in the game
+        auto [unit, correctedIndex] = m_grid[index];
+        if(correctedIndex != index) return;
+        Loc unitLoc = GameGrid::convertIndexToLocation(index);
+        const UnitDefinition& definition = getUnitDefinition(unit->type);
+        for(std::size_t actionIndex {}; actionIndex < definition.actionsCount; ++actionIndex)
+        {
+            if(!isActionUsable(unitLoc, actionIndex)) continue;
+            if(!requiresTarget(unitLoc, actionIndex))
+            {
+                decisions.push_back({false, unitLoc, actionIndex});
+                continue;
+            }
+            auto squares = getActionSquares(unitLoc, actionIndex);
+            Bitboard targets = squares.squares & ~squares.nonInteractable & ~m_grid.getObjectMask(unitLoc);
+            Bitboard usedTargets;//the cells of a large target are the same target
+            targets.forEach([&](std::size_t targetIndex)
+            {
+                if(usedTargets.test(targetIndex)) return;
+                Loc target = GameGrid::convertIndexToLocation(targetIndex);
+                if(m_grid.at(target)) usedTargets |= m_grid.getObjectMask(target);
+                decisions.push_back({false, unitLoc, actionIndex, target});
+            });
+        }
+    });
+}
+bool Match::isLegal(const Decision& decision) const
+{
+    if(decision.endTurn) return true;
+    if(m_gameOver) return false;
+    const GridCell* unit = m_grid.at(decision.unit);
+    if(!unit || unit->team != getCurrentTeam() || decision.actionIndex >= getUnitDefinition(unit->type).actionsCount) return false;
+    if(!isActionUsable(decision.unit, decision.actionIndex)) return false;
+    if(requiresTarget(decision.unit, decision.actionIndex) != decision.target.has_value()) return false;
+    return !decision.target || isValidTarget(decision.unit, decision.actionIndex, decision.target.value());
+}
+ActionResult Match::apply(const Decision& decision)
+{
+    if(decision.endTurn)
+    {
+        endTurn();
+        return {true};
+    }
+    return useAction(decision.unit, decision.actionIndex, decision.target);
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <vector>
+
+#include <core/mcts.hpp>
+#include <core/random.hpp>
+
+struct TreeNode
+{
+    Decision decision;
+    Team team {};//the team that made the decision
+    std::uint32_t firstChild {};
+    std::uint32_t childCount {};
+    bool expanded {};
+    std::uint32_t visits {};
+    float reward {};//summed for the team that made the decision
+    std::uint64_t hash {};//the position after the decision when it was last made
+};
+
+float evaluateMatch(const Match& match)
+{
+    const GameGrid& grid = match.getGameGrid();
+    auto hasBase = [&grid](Team team)
+    {
+        return (grid.getTeamMask(team) & (grid.getTypeMask(UnitTypes::base) | grid.getTypeMask(UnitTypes::baseUpgrade1) | grid.getTypeMask(UnitTypes::baseUpgrade2))).any();
+    };
+    if(match.isGameOver()) return hasBase(Team::playerOne) ? 1.f : 0.f;
+
+    auto getBaseLocation = [&](Team team)
+    {
+        std::size_t returnValue {};
+        (grid.getTeamMask(team) & grid.getLargeMask()).forEach([&returnValue](std::size_t index){returnValue = index;});
+        return GameGrid::convertIndexToLocation(returnValue);
+    };
+    auto score = [&](Team team)
+    {
+        float returnValue {};
+        auto enemyBase = getBaseLocation(team == Team::playerOne ? Team::playerTwo : Team::playerOne);
+        grid.getTeamMask(team).forEach([&](std::size_t index)
+        {
+            auto [cell, correctedIndex] = grid[index];
+            if(correctedIndex != index) return;
+            static constexpr float BASE_HEALTH_WEIGHT = 3.f, ATTACK_DAMAGE_WEIGHT = 2.f, ENEMY_BASE_DISTANCE_WEIGHT = 15.f;
+            if(isBase(cell->type))
+            {
+                returnValue += cell->health * BASE_HEALTH_WEIGHT;
+                return;
+            }
+            //units have to get close to the enemy base to attack it
+            auto [x, y] = GameGrid::convertIndexToLocation(index);
+            int distance = std::max(std::abs(static_cast<int>(x) - static_cast<int>(enemyBase.first)), std::abs(static_cast<int>(y) - static_cast<int>(enemyBase.second)));
+            returnValue += cell->health - distance * ENEMY_BASE_DISTANCE_WEIGHT;
+            const UnitDefinition& definition = getUnitDefinition(cell->type);
+            for(std::size_t i {}; i < definition.actionsCount; ++i)
+                if(definition.actions[i].kind == ActionKinds::attack) returnValue += definition.actions[i].damage * ATTACK_DAMAGE_WEIGHT;
+        });
+        //the money of the turn is paid when it ends, so it's counted in advance for the player to play. Otherwise ending the turn would look like a gain
+        const PlayerData& playerData = match.getPlayerData(team == Team::playerOne);
+        //money beyond what can be spent soon is worthless and would make the evaluation saturate
+        static constexpr int MAX_VALUED_MONEY = 1000;
+        int money = std::min(playerData.money + (team == match.getCurrentTeam() ? playerData.turnMoney : 0), MAX_VALUED_MONEY);
+        return returnValue + money * .5f + playerData.turnMoney;
+    };
+    static constexpr float EVALUATION_SCALE = 600.f;
+    return 1.f / (1.f + std::exp((score(Team::playerTwo) - score(Team::playerOne)) / EVALUATION_SCALE));
+}
+
+//a random decision of the player to play without enumerating all of them: a random usable action of a random unit
+static Decision getRandomDecision(const Match& match, RandomStream& random)
+{
+    const GameGrid& grid = match.getGameGrid();
+    std::array<std::size_t, GRID_SIZE * GRID_SIZE> units;
+    std::size_t unitCount {};
+    grid.getTeamMask(match.getCurrentTeam()).forEach([&](std::size_t index)
+    {
+        if(grid[index].second == index) units[unitCount++] = index;
+    });
+    static constexpr int ATTEMPTS = 4;
+    for(int i {}; i < ATTEMPTS && unitCount; ++i)
+    {
+        auto unitLoc = GameGrid::convertIndexToLocation(units[random.get<std::size_t>(0, unitCount - 1)]);
+        std::size_t actionIndex = random.get<std::size_t>(0, getUnitDefinition(grid.at(unitLoc)->type).actionsCount - 1);
+        if(!match.isActionUsable(unitLoc, actionIndex)) continue;
+        if(!match.requiresTarget(unitLoc, actionIndex)) return {false, unitLoc, actionIndex};
+        auto squares = match.getActionSquares(unitLoc, actionIndex);
+        Bitboard targets = squares.squares & ~squares.nonInteractable & ~grid.getObjectMask(unitLoc);
+        if(targets.none()) continue;
+        std::size_t chosen = random.get<std::size_t>(0, targets.count() - 1), targetIndex {};
+        targets.forEach([&](std::size_t index)
+        {
+            if(chosen-- == 0) targetIndex = index;
+        });
+        return {false, unitLoc, actionIndex, GameGrid::convertIndexToLocation(targetIndex)};
+    }
+    return {true};
+}
+//random decisions until the horizon. Every rollout ends on the same turn, so the evaluations are comparable
+static void rollout(Match& match, const MctsSettings& settings, int horizonTurn, RandomStream& random)
+{
+    for(int decisionsLeft = settings.maxRolloutDecisionsPerTurn; match.getTurnNumber() < horizonTurn && !match.isGameOver();)
+    {
+        Decision decision = decisionsLeft ? getRandomDecision(match, random) : Decision {true};
+        match.apply(decision);
+        if(decision.endTurn) decisionsLeft = settings.maxRolloutDecisionsPerTurn;
+        else --decisionsLeft;
+    }
+}
+
+struct RootChild
+{
+    std::uint32_t visits {};
+    float reward {};
+};
+//grows one tree until the deadline and returns the root's children
+static std::vector<RootChild> growTree(const Match& root, const std::vector<Decision>& rootDecisions, const MctsSettings& settings,
+    TranspositionTable& transpositions, std::size_t treeIndex, std::chrono::steady_clock::time_point deadline, std::size_t& iterationCount)
+{
+    //derived from the position, so the search doesn't depend on anything but the match and the settings
+    RandomStream random(root.getHash(), treeIndex);
+    std::vector<TreeNode> nodes;
+    nodes.emplace_back();
+    auto expand = [&nodes](std::uint32_t nodeIndex, const std::vector<Decision>& decisions, Team team)
+    {
+        nodes[nodeIndex].firstChild = static_cast<std::uint32_t>(nodes.size());
+        nodes[nodeIndex].childCount = static_cast<std::uint32_t>(decisions.size());
+        nodes[nodeIndex].expanded = true;
+        for(const auto& decision : decisions) nodes.push_back({decision, team});
+    };
+    expand(0, rootDecisions, root.getCurrentTeam());
+
+    std::vector<Decision> decisions;
+    std::vector<std::uint32_t> visitedNodes;
+    std::vector<std::uint32_t> illegalChildren;
+    do
+    {
+        Match match = root;
+        match.setRandom(RandomStream(random.next(), treeIndex));//the damage is sampled again on every iteration
+        visitedNodes.assign(1, 0);
+        std::uint32_t nodeIndex {};
+        //selection
+        while(!match.isGameOver())
+        {
+            if(!nodes[nodeIndex].expanded)
+            {
+                match.getLegalDecisions(decisions);
+                expand(nodeIndex, decisions, match.getCurrentTeam());
+            }
+            const TreeNode& node = nodes[nodeIndex];
+            //the children were generated from a different sample of the state, so some of them may be illegal now
+            illegalChildren.clear();
+            std::uint32_t selectedChild {};
+            while(true)
+            {
+                float bestValue = -std::numeric_limits<float>::infinity();
+                selectedChild = 0;
+                for(std::uint32_t i = node.firstChild; i < node.firstChild + node.childCount; ++i)
+                {
+                    if(std::find(illegalChildren.begin(), illegalChildren.end(), i) != illegalChildren.end()) continue;
+                    const TreeNode& child = nodes[i];
+                    float value = std::numeric_limits<float>::max();
+                    if(child.visits)
+                    {
+                        //the position has usually been reached more often through the other trees and move orders
+                        float averageReward = child.reward / child.visits;
+                        auto statistics = transpositions.probe(child.hash);
+                        if(statistics && statistics->visits > child.visits)
+                            averageReward = child.team == Team::playerOne ? statistics->reward : 1.f - statistics->reward;
+                        value = averageReward + settings.exploration * std::sqrt(std::log(static_cast<float>(node.visits)) / child.visits);
+                    }
+                    if(value > bestValue)
+                    {
+                        bestValue = value;
+                        selectedChild = i;
+                    }
+                }
+                if(!selectedChild || match.isLegal(nodes[selectedChild].decision)) break;
+                illegalChildren.push_back(selectedChild);
+            }
+            if(!selectedChild) break;
+            bool newNode = !nodes[selectedChild].visits;
+            match.apply(nodes[selectedChild].decision);
+            nodes[selectedChild].hash = match.getHash();
+            nodeIndex = selectedChild;
+            visitedNodes.push_back(nodeIndex);
+            if(newNode) break;
+        }
+        //a position that has been evaluated already isn't rolled out again
+        float playerOneReward {};
+        auto leafStatistics = transpositions.probe(match.getHash());
+        if(leafStatistics && visitedNodes.size() > 1) playerOneReward = leafStatistics->reward;
+        else
+        {
+            rollout(match, settings, root.getTurnNumber() + settings.rolloutTurns, random);
+            playerOneReward = evaluateMatch(match);
+        }
+
+        //backpropagation
+        for(auto visitedNode : visitedNodes)
+        {
+            TreeNode& node = nodes[visitedNode];
+            ++node.visits;
+            node.reward += node.team == Team::playerOne ? playerOneReward : 1.f - playerOneReward;
+            if(visitedNode) transpositions.add(node.hash, playerOneReward);
+        }
+        ++iterationCount;
+    } while(settings.iterationBudget ? iterationCount < settings.iterationBudget : std::chrono::steady_clock::now() < deadline);
+
+    std::vector<RootChild> returnValue(rootDecisions.size());
+    for(std::size_t i {}; i < returnValue.size(); ++i)
+        returnValue[i] = {nodes[nodes[0].firstChild + i].visits, nodes[nodes[0].firstChild + i].reward};
+    return returnValue;
+}
+
+MctsPlayer::MctsPlayer(const MctsSettings& settings) : m_settings(settings), m_transpositions(settings.transpositionTableSizeLog2)
+{
+    if(settings.threadCount > 1) m_pool = std::make_unique<ThreadPool>(settings.threadCount);
+}
+Decision MctsPlayer::search(const Match& match)
+{
+    m_lastIterationCount = 0;
+    Match root = match;
+    root.setListener(nullptr);
+    std::vector<Decision> rootDecisions;
+    root.getLegalDecisions(rootDecisions);
+    if(rootDecisions.size() == 1) return rootDecisions.front();
+
+    auto deadline = std::chrono::steady_clock::now() + m_settings.timeBudget;
+    std::size_t treeCount = m_pool ? m_pool->getThreadCount() : 1;
+    std::vector<std::size_t> iterationCounts(treeCount);
+    std::vector<RootChild> children(rootDecisions.size());
+    auto addTree = [&children](const std::vector<RootChild>& treeChildren)
+    {
+        for(std::size_t i {}; i < children.size(); ++i)
+        {
+            children[i].visits += treeChildren[i].visits;
+            children[i].reward += treeChildren[i].reward;
+        }
+    };
+    if(m_pool)
+    {
+        std::vector<std::future<std::vector<RootChild>>> trees;
+        for(std::size_t i {}; i < treeCount; ++i)
+        {
+            trees.push_back(m_pool->submit([&, i]()
+            {
+                return growTree(root, rootDecisions, m_settings, m_transpositions, i, deadline, iterationCounts[i]);
+            }));
+        }
+        for(auto& tree : trees) addTree(tree.get());
+    }
+    else addTree(growTree(root, rootDecisions, m_settings, m_transpositions, 0, deadline, iterationCounts[0]));
+    for(auto iterationCount : iterationCounts) m_lastIterationCount += iterationCount;
+    //the most visited decision, or the one with the better average when the visits are equal
+    auto bestChild = std::max_element(children.begin(), children.end(), [](const RootChild& lhs, const RootChild& rhs)
+    {
+        if(lhs.visits != rhs.visits) return lhs.visits < rhs.visits;
+        return lhs.reward < rhs.reward;
+    });
+    return rootDecisions[std::distance(children.begin(), bestChild)];
+}
\ No newline at end of file
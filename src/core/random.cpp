@@ -0,0 +1,15 @@
+#include <array>
+#include <chrono>
+#include <random>
+
+#include <core/random.hpp>
+
+std::uint64_t createRandomSeed()
+{
+    std::random_device rd {};
+    std::seed_seq ss = {static_cast<std::seed_seq::result_type>(std::chrono::steady_clock::now().time_since_epoch().count()),
+        rd(), rd(), rd(), rd(), rd(), rd(), rd()};
+    std::array<std::uint32_t, 2> seed;
+    ss.generate(seed.begin(), seed.end());
+    return static_cast<std::uint64_t>(seed[0]) << 32 | seed[1];
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iterator>
+
+#include <core/replay.hpp>
+
+void Replay::add(const Decision& decision)
+{
+    assert(decision.actionIndex <= ACTION_INDEX_MASK);
+    PackedDecision packed {.flags = static_cast<std::uint8_t>(decision.actionIndex)};
+    if(decision.endTurn) packed = {.flags = END_TURN_FLAG};
+    else packed.unit = static_cast<std::uint8_t>(GameGrid::convertLocationToIndex(decision.unit));
+    if(decision.target)
+    {
+        packed.target = static_cast<std::uint8_t>(GameGrid::convertLocationToIndex(decision.target.value()));
+        packed.flags |= HAS_TARGET_FLAG;
+    }
+    m_decisions.push_back(packed);
+}
+Decision Replay::getDecision(std::size_t index) const
+{
+    const PackedDecision& packed = m_decisions[index];
+    if(packed.flags & END_TURN_FLAG) return {true};
+    Decision returnValue {false, GameGrid::convertIndexToLocation(packed.unit), static_cast<std::size_t>(packed.flags & ACTION_INDEX_MASK)};
+    if(packed.flags & HAS_TARGET_FLAG) returnValue.target = GameGrid::convertIndexToLocation(packed.target);
+    return returnValue;
+}
+void Replay::truncate(std::size_t size)
+{
+    m_decisions.resize(std::min(size, m_decisions.size()));
+}
+
+static constexpr std::size_t HEADER_SIZE = 4 + 2 + 2 + 8 + 4;
+template<typename T>
+static void writeLittleEndian(std::vector<std::uint8_t>& data, T value)
+{
+    for(std::size_t i {}; i < sizeof(T); ++i) data.push_back(static_cast<std::uint8_t>(static_cast<std::uint64_t>(value) >> (i * 8)));
+}
+template<typename T>
+static T readLittleEndian(std::span<const std::uint8_t> data, std::size_t offset)
+{
+    std::uint64_t returnValue {};
+    for(std::size_t i {}; i < sizeof(T); ++i) returnValue |= static_cast<std::uint64_t>(data[offset + i]) << (i * 8);
+    return static_cast<T>(returnValue);
+}
+std::vector<std::uint8_t> Replay::serialize() const
+{
+    std::vector<std::uint8_t> returnValue;
+    returnValue.reserve(HEADER_SIZE + m_decisions.size() * 3);
+    for(char character : MAGIC) returnValue.push_back(static_cast<std::uint8_t>(character));
+    writeLittleEndian(returnValue, VERSION);
+    writeLittleEndian(returnValue, static_cast<std::uint16_t>(GRID_SIZE));
+    writeLittleEndian(returnValue, m_seed);
+    writeLittleEndian(returnValue, static_cast<std::uint32_t>(m_decisions.size()));
+    for(const auto& decision : m_decisions)
+    {
+        returnValue.push_back(decision.unit);
+        returnValue.push_back(decision.target);
+        returnValue.push_back(decision.flags);
+    }
+    return returnValue;
+}
+std::optional<Replay> Replay::deserialize(std::span<const std::uint8_t> data)
+{
+    if(data.size() < HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), data.begin())) return std::nullopt;
+    if(readLittleEndian<std::uint16_t>(data, 4) != VERSION || readLittleEndian<std::uint16_t>(data, 6) != GRID_SIZE) return std::nullopt;
+    Replay returnValue(readLittleEndian<std::uint64_t>(data, 8));
+    std::size_t decisionCount = readLittleEndian<std::uint32_t>(data, 16);
+    if(data.size() != HEADER_SIZE + decisionCount * 3) return std::nullopt;
+    returnValue.m_decisions.resize(decisionCount);
+    for(std::size_t i {}; i < decisionCount; ++i)
+    {
+        std::size_t offset = HEADER_SIZE + i * 3;
+        returnValue.m_decisions[i] = {data[offset], data[offset + 1], data[offset + 2]};
+    }
+    return returnValue;
+}
+bool Replay::save(const std::filesystem::path& path) const
+{
+    auto data = serialize();
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(file);
+}
+std::optional<Replay> Replay::load(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file) return std::nullopt;
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return deserialize(data);
+}
+
+ReplayPlayer::ReplayPlayer(const Replay& replay, std::size_t snapshotInterval)
+    : m_replay(replay), m_state(Match(nullptr, replay.getSeed()).getState()), m_snapshotInterval(std::max(snapshotInterval, std::size_t {1}))
+{
+    m_snapshots.push_back(m_state);
+    m_turnStarts.push_back(0);
+    for(std::size_t i {}; i < replay.size(); ++i)
+        if(replay.getDecision(i).endTurn) m_turnStarts.push_back(i + 1);
+}
+bool ReplayPlayer::step()
+{
+    if(m_position == m_replay.size()) return false;
+    if(m_position % m_snapshotInterval == 0 && m_position / m_snapshotInterval == m_snapshots.size()) m_snapshots.push_back(m_state);
+
+    //the moves of the state don't check the rules, so at least the decision has to fit the objects
+    Decision decision = m_replay.getDecision(m_position);
+    if(!decision.endTurn)
+    {
+        if(m_state.gameOver) return false;
+        const StateCell& unit = m_state.cells[m_state.getObjectIndex(GameGrid::convertLocationToIndex(decision.unit))];
+        if(unit.type == UnitTypes::none || unit.team != (m_state.playerOneToPlay ? Team::playerOne : Team::playerTwo)) return false;
+        const UnitDefinition& definition = getUnitDefinition(unit.type);
+        if(decision.actionIndex >= definition.actionsCount) return false;
+        ActionKinds kind = definition.actions[decision.actionIndex].kind;
+        if((kind == ActionKinds::move || kind == ActionKinds::attack || kind == ActionKinds::buyUnit) != decision.target.has_value()) return false;
+        if(decision.target)
+        {
+            bool targetOccupied = m_state.cells[m_state.getObjectIndex(GameGrid::convertLocationToIndex(decision.target.value()))].type != UnitTypes::none;
+            if(targetOccupied != (kind == ActionKinds::attack)) return false;
+        }
+    }
+    m_state.makeMove(decision);
+    ++m_position;
+    return true;
+}
+bool ReplayPlayer::seek(std::size_t position)
+{
+    if(position > m_replay.size()) return false;
+    //from the closest snapshot unless the current state is closer
+    std::size_t snapshotIndex = std::min(position / m_snapshotInterval, m_snapshots.size() - 1);
+    if(position < m_position || snapshotIndex * m_snapshotInterval > m_position)
+    {
+        m_state = m_snapshots[snapshotIndex];
+        m_position = snapshotIndex * m_snapshotInterval;
+    }
+    while(m_position < position)
+        if(!step()) return false;
+    return true;
+}
+bool ReplayPlayer::seekToTurn(int turn)
+{
+    if(turn < 0 || turn >= getTurnCount()) return false;
+    return seek(m_turnStarts[turn]);
+}
\ No newline at end of file
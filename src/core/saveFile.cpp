@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <core/saveFile.hpp>
+
+static_assert(std::is_standard_layout_v<GameState>);
+
+bool SaveFile::save(const std::filesystem::path& path, std::span<const GameState> states)
+{
+    Header header {MAGIC, VERSION, BYTE_ORDER_MARK, GRID_SIZE, sizeof(GameState), states.size()};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(states.data()), static_cast<std::streamsize>(states.size_bytes()));
+    return static_cast<bool>(file);
+}
+std::optional<SaveFile> SaveFile::open(const std::filesystem::path& path)
+{
+    SaveFile returnValue;
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) return std::nullopt;
+    LARGE_INTEGER size {};
+    if(GetFileSizeEx(file, &size) && size.QuadPart >= static_cast<LONGLONG>(sizeof(Header)))
+    {
+        returnValue.m_mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(returnValue.m_mappingHandle)
+        {
+            returnValue.m_data = static_cast<const std::byte*>(MapViewOfFile(returnValue.m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            returnValue.m_size = static_cast<std::size_t>(size.QuadPart);
+        }
+    }
+    CloseHandle(file);//the mapping keeps the file open
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if(file < 0) return std::nullopt;
+    struct stat status {};
+    if(fstat(file, &status) == 0 && status.st_size >= static_cast<off_t>(sizeof(Header)))
+    {
+        void* mapping = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        if(mapping != MAP_FAILED)
+        {
+            returnValue.m_data = static_cast<const std::byte*>(mapping);
+            returnValue.m_size = static_cast<std::size_t>(status.st_size);
+        }
+    }
+    close(file);//the mapping keeps the file open
+#endif
+    if(!returnValue.m_data) return std::nullopt;
+
+    Header header;
+    std::memcpy(&header, returnValue.m_data, sizeof(header));
+    if(header.magic != MAGIC || header.version != VERSION || header.byteOrder != BYTE_ORDER_MARK || header.gridSize != GRID_SIZE
+        || header.stateSize != sizeof(GameState) || header.stateCount != (returnValue.m_size - sizeof(Header)) / sizeof(GameState)
+        || (returnValue.m_size - sizeof(Header)) % sizeof(GameState) != 0)
+        return std::nullopt;
+    for(const auto& state : returnValue.getStates())
+        if(!isValid(state)) return std::nullopt;
+    return returnValue;
+}
+SaveFile::SaveFile(SaveFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+SaveFile& SaveFile::operator=(SaveFile&& other) noexcept
+{
+    if(this == &other) return *this;
+    unmap();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+    m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#endif
+    return *this;
+}
+SaveFile::~SaveFile()
+{
+    unmap();
+}
+void SaveFile::unmap()
+{
+#ifdef _WIN32
+    if(m_data) UnmapViewOfFile(m_data);
+    if(m_mappingHandle) CloseHandle(m_mappingHandle);
+    m_mappingHandle = nullptr;
+#else
+    if(m_data) munmap(const_cast<std::byte*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+std::span<const GameState> SaveFile::getStates() const
+{
+    if(!m_data) return {};
+    //the mapping is page aligned and the header keeps the states aligned
+    return {reinterpret_cast<const GameState*>(m_data + sizeof(Header)), (m_size - sizeof(Header)) / sizeof(GameState)};
+}
+bool SaveFile::isValid(const GameState& state)
+{
+    //bools with other values than 0 and 1 can't even be read
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&state);
+    if(bytes[offsetof(GameState, playerOneToPlay)] > 1 || bytes[offsetof(GameState, gameOver)] > 1) return false;
+    if(state.turnNumber < 0) return false;
+    for(const PlayerData* playerData : {&state.playerOne, &state.playerTwo})
+        if(playerData->money < 0 || playerData->moves < 0 || playerData->moves > playerData->maxMoves || playerData->turnMoney < 0) return false;
+
+    Bitboard occupied;
+    for(std::size_t index {}; index < state.cells.size(); ++index)
+    {
+        const StateCell& cell = state.cells[index];
+        if(static_cast<std::size_t>(cell.type) >= static_cast<std::size_t>(UnitTypes::count) || static_cast<std::size_t>(cell.team) > static_cast<std::size_t>(Team::neutral))
+            return false;
+        if(cell.type == UnitTypes::none)
+        {
+            if(state.usedAttacks.test(index)) return false;
+            continue;
+        }
+        const UnitDefinition& definition = getUnitDefinition(cell.type);
+        if(cell.health < 0 || cell.health > definition.health || (definition.health && cell.health == 0)) return false;
+        if((cell.team == Team::neutral) != (cell.type == UnitTypes::island)) return false;
+        std::array<std::size_t, 4> covered {index, index, index, index};
+        std::size_t coveredCount = 1;
+        if(definition.large)
+        {
+            //large objects are at even coordinates, so they can't cross the edge
+            if(index % GRID_SIZE % 2 != 0 || index / GRID_SIZE % 2 != 0) return false;
+            covered = {index, index + 1, index + GRID_SIZE, index + 1 + GRID_SIZE};
+            coveredCount = 4;
+        }
+        for(std::size_t i {}; i < coveredCount; ++i)
+        {
+            if(occupied.test(covered[i])) return false;
+            occupied.set(covered[i]);
+        }
+    }
+    return true;
+}
\ No newline at end of file
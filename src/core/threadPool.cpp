@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <utility>
+
+#include <core/threadPool.hpp>
+
+//the queue of the worker running on this thread, which its own submissions go to
+static thread_local const ThreadPool* currentPool {};
+static thread_local std::size_t currentQueueIndex {};
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    m_queues.reserve(threadCount);
+    for(std::size_t i {}; i < threadCount; ++i) m_queues.push_back(std::make_unique<WorkerQueue>());
+    m_workers.reserve(threadCount);
+    for(std::size_t i {}; i < threadCount; ++i)
+        m_workers.emplace_back(&ThreadPool::work, this, i);
+}
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+    for(auto& worker : m_workers) worker.join();
+}
+std::size_t ThreadPool::defaultThreadCount()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+void ThreadPool::push(std::function<void()> task)
+{
+    //tasks from outside are spread over the queues
+    std::size_t queueIndex = currentPool == this ? currentQueueIndex : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        std::lock_guard lock(m_queues[queueIndex]->mutex);
+        m_queues[queueIndex]->tasks.push_back(std::move(task));
+    }
+    m_pendingTasks.fetch_add(1);
+    //a worker counts itself as sleeping under the lock before it checks the tasks, so taking the lock here means it either sees the task or is waiting
+    if(!m_sleepingWorkers.load()) return;
+    {
+        std::lock_guard lock(m_mutex);
+    }
+    m_condition.notify_one();
+}
+bool ThreadPool::reserveTask()
+{
+    std::size_t pending {m_pendingTasks.load()};
+    while(pending && !m_pendingTasks.compare_exchange_weak(pending, pending - 1));
+    return pending;
+}
+bool ThreadPool::pop(std::size_t queueIndex, std::function<void()>& task)
+{
+    //the own queue from the front, the others from the back
+    for(std::size_t i {}; i < m_queues.size(); ++i)
+    {
+        WorkerQueue& queue = *m_queues[(queueIndex + i) % m_queues.size()];
+        std::lock_guard lock(queue.mutex);
+        if(queue.tasks.empty()) continue;
+        if(i == 0)
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        else
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        return true;
+    }
+    return false;
+}
+void ThreadPool::work(std::size_t queueIndex)
+{
+    currentPool = this;
+    currentQueueIndex = queueIndex;
+    while(true)
+    {
+        if(!reserveTask())
+        {
+            std::unique_lock lock(m_mutex);
+            ++m_sleepingWorkers;
+            m_condition.wait(lock, [this](){return m_stopping || m_pendingTasks.load();});
+            --m_sleepingWorkers;
+            //the remaining tasks are finished before stopping
+            if(m_stopping && !m_pendingTasks.load()) return;
+            continue;
+        }
+        //a task is reserved for this worker, but it may have to be stolen
+        std::function<void()> task;
+        while(!pop(queueIndex, task)) std::this_thread::yield();
+        task();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include <core/transpositionTable.hpp>
+
+TranspositionTable::TranspositionTable(int sizeLog2) : m_entries(std::size_t {1} << sizeLog2), m_mask(m_entries.size() - 1)
+{
+    assert(sizeLog2 >= 0 && sizeLog2 <= 64 - CHECK_BITS && "The index and the check bits of the hash shouldn't overlap");
+}
+std::optional<TranspositionTable::Statistics> TranspositionTable::probe(std::uint64_t hash) const
+{
+    std::uint64_t entry = m_entries[hash & m_mask].load(std::memory_order_relaxed);
+    std::uint32_t visits = static_cast<std::uint32_t>(entry >> REWARD_BITS & MAX_VISITS);
+    if(!visits || entry >> (REWARD_BITS + VISIT_BITS) != getCheck(hash)) return std::nullopt;
+    return Statistics {visits, static_cast<float>(entry & REWARD_SCALE) / REWARD_SCALE};
+}
+void TranspositionTable::add(std::uint64_t hash, float reward)
+{
+    std::atomic<std::uint64_t>& entry = m_entries[hash & m_mask];
+    std::uint64_t oldEntry = entry.load(std::memory_order_relaxed), newEntry;
+    do
+    {
+        std::uint64_t visits = oldEntry >> REWARD_BITS & MAX_VISITS;
+        float average = static_cast<float>(oldEntry & REWARD_SCALE) / REWARD_SCALE;
+        if(!visits || oldEntry >> (REWARD_BITS + VISIT_BITS) != getCheck(hash))
+        {
+            //always replaced, the recent positions are the likely ones to be reached again
+            visits = 0;
+            average = 0.f;
+        }
+        average += (std::clamp(reward, 0.f, 1.f) - average) / static_cast<float>(visits + 1);
+        visits = std::min(visits + 1, MAX_VISITS);
+        newEntry = getCheck(hash) << (REWARD_BITS + VISIT_BITS) | visits << REWARD_BITS | static_cast<std::uint64_t>(std::lround(average * REWARD_SCALE));
+    } while(!entry.compare_exchange_weak(oldEntry, newEntry, std::memory_order_relaxed));
+}
+void TranspositionTable::clear()
+{
+    for(auto& entry : m_entries) entry.store(0, std::memory_order_relaxed);
+}
\ No newline at end of file
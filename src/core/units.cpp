@@ -0,0 +1,85 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include <core/units.hpp>
+
+static constexpr ActionDefinition moveAction(int radius, SelectOnGridTypes moveType = SelectOnGridTypes::area)
+{
+    return {.kind = ActionKinds::move, .radius = radius, .selectType = moveType};
+}
+static constexpr ActionDefinition attackAction(int price, int radius, int damage)
+{
+    return {.kind = ActionKinds::attack, .price = price, .radius = radius, .selectType = SelectOnGridTypes::selectEnemyUnit, .damage = damage};
+}
+static constexpr ActionDefinition buyUnitAction(int price, int radius, UnitTypes unit)
+{
+    return {.kind = ActionKinds::buyUnit, .price = price, .radius = radius, .unit = unit};
+}
+static constexpr ActionDefinition upgradeAction(int price, UnitTypes upgradeUnit)
+{
+    return {.kind = ActionKinds::upgrade, .price = price, .unit = upgradeUnit};
+}
+static constexpr ActionDefinition baseUpgradeAction(int price, UnitTypes upgradeUnit, int newMaxMoves, int newTurnMoney)
+{
+    return {.kind = ActionKinds::upgrade, .price = price, .unit = upgradeUnit, .newMaxMoves = newMaxMoves, .newTurnMoney = newTurnMoney};
+}
+static constexpr ActionDefinition sellAction(int worth)
+{
+    return {.kind = ActionKinds::sell, .worth = worth};
+}
+
+static constexpr int BUY_UNIT_RADIUS = 5;
+#define BUY_UNITS buyUnitAction(250, BUY_UNIT_RADIUS, UnitTypes::submarine), buyUnitAction(350, BUY_UNIT_RADIUS, UnitTypes::ship), buyUnitAction(450, BUY_UNIT_RADIUS, UnitTypes::aircraftCarrier)
+
+static constexpr int SUBMARINE_MOVE_RADIUS = 5;
+static constexpr int SUBMARINE_HEALTH = 150;
+static constexpr int SHIP_MOVE_RADIUS = 3;
+static constexpr int SHIP_HEALTH = 200;
+static constexpr int AIRCRAFT_CARRIER_MOVE_RADIUS = 3;
+static constexpr int AIRCRAFT_CARRIER_HEALTH = 250;
+
+static constexpr std::array<UnitDefinition, static_cast<std::size_t>(UnitTypes::count)> UNIT_DEFINITIONS
+{{
+    //none
+    {},
+    //island
+    {.name = "ISLAND", .large = true},
+    //base
+    {.name = "BASE", .health = BASE_HEALTH, .large = true,
+        .actions = {BUY_UNITS, baseUpgradeAction(600, UnitTypes::baseUpgrade1, 3, 250)}, .actionsCount = 4},
+    //baseUpgrade1
+    {.name = "BASE", .health = BASE_HEALTH, .large = true,
+        .actions = {BUY_UNITS, baseUpgradeAction(900, UnitTypes::baseUpgrade2, 4, 300)}, .actionsCount = 4},
+    //baseUpgrade2
+    {.name = "BASE", .health = BASE_HEALTH, .large = true,
+        .actions = {BUY_UNITS}, .actionsCount = 3},
+    //submarine
+    {.name = "SUBMARINE", .health = SUBMARINE_HEALTH,
+        .actions = {moveAction(SUBMARINE_MOVE_RADIUS), attackAction(20, 3, 100), upgradeAction(350, UnitTypes::submarineUpgrade1), sellAction(50)}, .actionsCount = 4},
+    //submarineUpgrade1
+    {.name = "SUBMARINE", .health = SUBMARINE_HEALTH,
+        .actions = {moveAction(SUBMARINE_MOVE_RADIUS + 1), attackAction(20, 4, 150), sellAction(75)}, .actionsCount = 3},
+    //ship
+    {.name = "SHIP", .health = SHIP_HEALTH,
+        .actions = {moveAction(SHIP_MOVE_RADIUS), attackAction(30, 4, 150), sellAction(75)}, .actionsCount = 3},
+    //aircraftCarrier
+    {.name = "AIRCRAFT CARRIER", .health = AIRCRAFT_CARRIER_HEALTH,
+        .actions = {moveAction(AIRCRAFT_CARRIER_MOVE_RADIUS, SelectOnGridTypes::cross), attackAction(40, 6, 200), upgradeAction(500, UnitTypes::aircraftCarrierUpgrade1), sellAction(100)}, .actionsCount = 4},
+    //aircraftCarrierUpgrade1
+    {.name = "AIRCRAFT CARRIER", .health = AIRCRAFT_CARRIER_HEALTH,
+        .actions = {moveAction(AIRCRAFT_CARRIER_MOVE_RADIUS + 1, SelectOnGridTypes::cross), attackAction(40, 7, 250), sellAction(125)}, .actionsCount = 3},
+}};
+
+const UnitDefinition& getUnitDefinition(UnitTypes type)
+{
+    assert(type < UnitTypes::count);
+    return UNIT_DEFINITIONS[static_cast<std::size_t>(type)];
+}
+static_assert([]()
+{
+    for(auto& unit : UNIT_DEFINITIONS)
+        for(std::size_t i {}; i < unit.actionsCount; ++i)
+            if(unit.actions[i].kind == ActionKinds::attack && unit.actions[i].damage < 25) return false;
+    return true;
+}(), "Attack damage must be at least 25 so that an attack never heals");
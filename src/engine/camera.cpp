@@ -69,24 +69,27 @@ void OrbitingCamera::update()
     else
     {
         if(m_stopped) return;
-        m_time += deltaTime * (m_decreasing ? -1.f : 1.f);
-        if(static_cast<int>(m_maxPercentageOfCircle) != 1)
+        if(m_orbiting)
         {
-            float percentage = (m_time * m_speed) / (2 * std::numbers::pi);
-            if(m_decreasing)
+            m_time += deltaTime * (m_decreasing ? -1.f : 1.f);
+            if(static_cast<int>(m_maxPercentageOfCircle) != 1)
             {
-                if(percentage <= 0.f)
+                float percentage = (m_time * m_speed) / (2 * std::numbers::pi);
+                if(m_decreasing)
                 {
-                    m_decreasing = false;
-                    return;
+                    if(percentage <= 0.f)
+                    {
+                        m_decreasing = false;
+                        return;
+                    }
                 }
-            }
-            else
-            {
-                if(percentage >= m_maxPercentageOfCircle)
+                else
                 {
-                    m_decreasing = true;
-                    return;
+                    if(percentage >= m_maxPercentageOfCircle)
+                    {
+                        m_decreasing = true;
+                        return;
+                    }
                 }
             }
         }
@@ -98,6 +101,11 @@ void OrbitingCamera::update()
     m_position.z = frameLookAtPoint.z + static_cast<float>(std::cos(m_time * m_speed - std::numbers::pi * m_maxPercentageOfCircle) * frameRadius);
     m_view = glm::lookAt(m_position, frameLookAtPoint, glm::vec3(.0f, 1.0f, .0f));
 }
+bool OrbitingCamera::isMoving() const
+{
+    if(m_zoomProperties.has_value()) return m_zoomProperties->zoomOut || m_zoomProperties->timeLeft > 0.f;
+    return m_orbiting && !m_stopped;
+}
 void OrbitingCamera::stopMovement()
 {
     m_stopped = true;
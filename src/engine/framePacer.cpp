@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+
+#include <engine/framePacer.hpp>
+
+static constexpr std::chrono::milliseconds SLEEP_STEP {1};
+
+FramePacer::FramePacer()
+{
+    setMode(m_mode);
+}
+void FramePacer::setMode(FramePacingModes mode, float frameRate)
+{
+    assert(frameRate > 0.f && "The frame rate cap has to be positive");
+    m_mode = mode;
+    m_frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1. / frameRate));
+    restart();
+}
+float FramePacer::getFrameRate() const
+{
+    return 1.f / std::chrono::duration<float>(m_frameTime).count();
+}
+void FramePacer::waitUntil(Clock::time_point time)
+{
+    for(Clock::time_point now {Clock::now()}; time - now > m_sleepEstimate; )
+    {
+        std::this_thread::sleep_for(SLEEP_STEP);
+        Clock::time_point sleepEnd {Clock::now()};
+        //follows the longest sleep and slowly recovers from an outlier
+        m_sleepEstimate = std::max(sleepEnd - now, m_sleepEstimate - m_sleepEstimate / 64);
+        now = sleepEnd;
+    }
+    while(Clock::now() < time);
+}
+float FramePacer::endFrame()
+{
+    if(m_mode == FramePacingModes::capped)
+    {
+        m_deadline += m_frameTime;
+        Clock::time_point now {Clock::now()};
+        //a frame that took too long moves the next ones instead of them being rushed to catch up
+        if(m_deadline < now) m_deadline = now;
+        else waitUntil(m_deadline);
+    }
+    Clock::time_point now {Clock::now()};
+    float returnValue = std::chrono::duration<float>(now - m_lastFrame).count();
+    m_lastFrame = now;
+    addFrameTime(returnValue * 1000.f);
+    return returnValue;
+}
+void FramePacer::restart()
+{
+    m_lastFrame = m_deadline = Clock::now();
+    m_previousFrameTime = 0.f;
+}
+void FramePacer::addFrameTime(float frameTime)
+{
+    m_jitters.add(m_previousFrameTime > 0.f ? std::abs(frameTime - m_previousFrameTime) : 0.f);
+    m_previousFrameTime = frameTime;
+    m_frameTimes.add(frameTime);
+}
+FrameTimeStatistics FramePacer::getStatistics() const
+{
+    SampleStatistics frameTimes = m_frameTimes.getStatistics();
+    return {frameTimes.average, frameTimes.p50, frameTimes.p95, frameTimes.p99, m_jitters.getAverage(), frameTimes.samples};
+}
\ No newline at end of file
@@ -12,8 +12,23 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <engine/meshManager.hpp>
+#include <engine/renderEngine.hpp>
+
+void Mesh::use() const
+{
+    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    renderEngineInstance.bindVertexArray(VAO);
+}
 
 Mesh generateGrid(int gridSize, bool normals);
+Mesh generateMergedMesh(std::span<const MeshPart> parts);
+Mesh MeshManager::getMergedMesh(int key, std::span<const MeshPart> parts)
+{
+    auto mesh = m_mergedMeshes.find(key);
+    if(mesh == m_mergedMeshes.end())
+        mesh = m_mergedMeshes.emplace(key, generateMergedMesh(parts)).first;
+    return mesh->second;
+}
 Mesh MeshManager::getGrid(int size, NormalMode normalMode)
 {
     auto& gridVariations {m_gridMeshes[size]};
@@ -102,6 +117,50 @@ Mesh generateGrid(int gridSize, bool normals)
 
     return {generateVAO(vertices.get(), verticesLength, indices.get(), indicesLength, normals), indicesLength};
 }
+Mesh generateMergedMesh(std::span<const MeshPart> parts)
+{
+    //position, normal, color and the other material properties
+    static constexpr int VERTEX_LENGTH {12};
+    std::vector<float> vertices;
+    std::vector<unsigned int> indices;
+    for(auto& part : parts)
+    {
+        assert(part.normals && "The merged meshes are lit, so the parts need normals");
+        unsigned int firstVertex {static_cast<unsigned int>(vertices.size() / VERTEX_LENGTH)};
+        const Material& material {part.material};
+        for(std::size_t i {}; i + 6 <= part.vertices.size(); i += 6)
+        {
+            vertices.insert(vertices.end(), part.vertices.begin() + i, part.vertices.begin() + i + 6);
+            vertices.insert(vertices.end(), {material.color.x, material.color.y, material.color.z,
+                material.ambientStrength, material.shininess, material.specularStrength});
+        }
+        for(auto index : part.indices)
+            indices.push_back(firstVertex + index);
+    }
+
+    unsigned int EBO {}, VBO {}, VAO {};
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glGenBuffers(1, &VBO);
+    glGenBuffers(1, &EBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
+
+    auto setAttribute = [](unsigned int location, int offset)
+    {
+        glVertexAttribPointer(location, 3, GL_FLOAT, GL_FALSE, VERTEX_LENGTH * sizeof(float), (void*)(offset * sizeof(float)));
+        glEnableVertexAttribArray(location);
+    };
+    setAttribute(0, 0);
+    setAttribute(1, 3);
+    setAttribute(MATERIAL_COLOR_LOCATION, 6);
+    setAttribute(MATERIAL_PROPERTIES_LOCATION, 9);
+    glBindVertexArray(0);
+
+    return {VAO, static_cast<unsigned int>(indices.size()), static_cast<unsigned int>(vertices.size() / VERTEX_LENGTH), true};
+}
 unsigned int generateVAO(const float vertices[], int verticesLength, const unsigned int indices[], int indicesLength, bool normals)
 {
     unsigned int EBO {}, VBO {}, VAO {};
@@ -1,6 +1,8 @@
-#include <format>
 #include <cstddef>
 #include <utility>
+#include <span>
+#include <cstdint>
+#include <algorithm>
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
@@ -24,9 +26,26 @@ void ObjectEntity::removeFromRenderEngine()
     for(auto& obj : m_objects)
         obj->removeFromRenderEngine();
 }
+void ObjectEntity::setVisible(bool visible)
+{
+    m_visible = visible;
+    for(auto& obj : m_objects)
+        obj->setVisible(visible);
+}
 
+Object::Object(Mesh mesh, Shader* shader, bool useTime, ObjectKinds kind)
+    : m_mesh(mesh), m_shader(shader), m_useTime(useTime), m_kind(kind), m_timeUniform(shader->getUniform<float>("time")) {}
+Object::Object(Object&& other) noexcept
+    : m_useTime(other.m_useTime), m_visible(other.m_visible), m_kind(other.m_kind), m_renderHandle(std::exchange(other.m_renderHandle, {})),
+    m_mesh(other.m_mesh), m_shader(other.m_shader), m_timeUniform(other.m_timeUniform), m_model(other.m_model), m_renderType(other.m_renderType)
+{
+    //the render engine refers to the object by its address
+    if(m_renderHandle.isValid()) (*m_renderHandle.slots)[m_renderHandle.slot].object = this;
+}
 void Object::drawMesh() const
 {
+    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    renderEngineInstance.countDraw();
     m_mesh.use();
     if(m_mesh.indicesLength)
         glDrawElements(GL_TRIANGLES, m_mesh.indicesLength, GL_UNSIGNED_INT, 0);
@@ -37,36 +56,35 @@ void Object::configureShaders() const
     if(m_useTime)
     {
         static GLFWController& glfwControllerInstance = GLFWController::getInstance();
-
-        unsigned int timeLoc = glGetUniformLocation(m_shader->getID(), "time");
-        glUniform1f(timeLoc, glfwControllerInstance.getTime());
+        m_timeUniform.set(glfwControllerInstance.getTime());
     }
 }
 void Object::addToRenderEngine(Object3DRenderTypes renderType)
 {
-    m_renderType = renderType;
     static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
-    renderEngineInstance.addObject(this, renderType);
+    if(m_renderHandle.isValid())
+    {
+        if(renderType == m_renderType) return;
+        renderEngineInstance.removeObject(m_renderHandle);
+    }
+    m_renderType = renderType;
+    m_renderHandle = renderEngineInstance.addObject(this, renderType);
 }
 void Object::removeFromRenderEngine()
 {
     static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
-    renderEngineInstance.removeObject(this, m_renderType);
+    if(m_renderHandle.isValid())
+        renderEngineInstance.removeObject(m_renderHandle);
 }
 void Object::setModel(glm::mat4 model)
 {
     m_model = model;
 }
+Object3D::Object3D(Mesh mesh, Shader* shader, bool useTime, ObjectKinds kind)
+    : Object(mesh, shader, useTime, kind), m_modelUniform(shader->getUniform<glm::mat4>("model")) {}
 void Object3D::configureShaders() const
 {
-    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
-    unsigned int modelLoc = glGetUniformLocation(m_shader->getID(), "model");
-    unsigned int viewLoc = glGetUniformLocation(m_shader->getID(), "view");
-    unsigned int projectionLoc = glGetUniformLocation(m_shader->getID(), "projection");
-
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(m_model));
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(renderEngineInstance.getView()));
-    glUniformMatrix4fv(projectionLoc, 1, GL_FALSE, glm::value_ptr(renderEngineInstance.getProjection()));
+    m_modelUniform.set(m_model);
 }
 
 void Object3D::draw() const
@@ -77,74 +95,70 @@ void Object3D::draw() const
     drawMesh();
 }
 
-void LitObject::configureShaders() const
+void LitObject::drawInstances(std::span<const InstanceData> instances) const
 {
+    //shared by all the batches. The data is replaced before every draw
+    static unsigned int instanceBuffer {[]()
+    {
+        unsigned int buffer {};
+        glGenBuffers(1, &buffer);
+        return buffer;
+    }()};
+    if(instances.empty()) return;
     static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
-    unsigned int colorLoc = glGetUniformLocation(m_shader->getID(), "material.color");
-    glUniform3fv(colorLoc, 1, glm::value_ptr(m_material.color));
-    unsigned int ambientStengthLoc = glGetUniformLocation(m_shader->getID(), "material.ambientStrength");
-    glUniform1f(ambientStengthLoc, m_material.ambientStrength);
-    unsigned int shininessLoc = glGetUniformLocation(m_shader->getID(), "material.shininess");
-    glUniform1f(shininessLoc, m_material.shininess);
-    unsigned int specStrengthLoc = glGetUniformLocation(m_shader->getID(), "material.specularStrength");
-    glUniform1f(specStrengthLoc, m_material.specularStrength);
+    renderEngineInstance.countDraw(instances.size());
 
-    glm::vec3 objectPosition(m_model[3]);
+    //the camera and the lights are in the uniform blocks and the rest is in the instance attributes
+    m_shader->use();
+    Object::configureShaders();
 
-    //directional light
-    auto dirLight {renderEngineInstance.getLighting()->getDirectionalLight()};
-    if(dirLight)
+    m_mesh.use();
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, instances.size_bytes(), instances.data(), GL_STREAM_DRAW);
+    //the attributes are stored in the VAO of the mesh, so they are set again for the new buffer
+    for(unsigned int column {}; column < 4; ++column)
     {
-        unsigned int dirLightColorLoc = glGetUniformLocation(m_shader->getID(), "directionalLight.color");
-        glUniform3fv(dirLightColorLoc, 1, glm::value_ptr(dirLight->color));
-        unsigned int dirLightDirLoc = glGetUniformLocation(m_shader->getID(), "directionalLight.direction");
-        glUniform3fv(dirLightDirLoc, 1, glm::value_ptr(dirLight->direction));
-        unsigned int dirLightStrengthLoc = glGetUniformLocation(m_shader->getID(), "directionalLight.strength");
-        glUniform1f(dirLightStrengthLoc, dirLight->strength);
+        glVertexAttribPointer(INSTANCE_MODEL_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(column * sizeof(glm::vec4)));
+        glEnableVertexAttribArray(INSTANCE_MODEL_LOCATION + column);
+        glVertexAttribDivisor(INSTANCE_MODEL_LOCATION + column, 1);
     }
-    //point lights
-    auto& lights {renderEngineInstance.getLighting()->getPointLights()};
-    auto lightsSize {std::ssize(lights)};
-    for(std::size_t i {}; i < lightsSize; ++i)
+    if(!m_mesh.vertexMaterials)
     {
-        unsigned int lightColorLoc = glGetUniformLocation(m_shader->getID(), std::format("lights[{}].color", i).c_str());
-        glUniform3fv(lightColorLoc, 1, glm::value_ptr(lights[i]->color));
-        unsigned int lightPosLoc = glGetUniformLocation(m_shader->getID(), std::format("lights[{}].position", i).c_str());
-        glUniform3fv(lightPosLoc, 1, glm::value_ptr(lights[i]->position));
-        unsigned int lightStrengthLoc = glGetUniformLocation(m_shader->getID(), std::format("lights[{}].strength", i).c_str());
-        glUniform1f(lightStrengthLoc, lights[i]->strength);
-        unsigned int lightLinearLoc = glGetUniformLocation(m_shader->getID(), std::format("lights[{}].linear", i).c_str());
-        glUniform1f(lightLinearLoc, lights[i]->linear);
-        unsigned int lightQuadraticLoc = glGetUniformLocation(m_shader->getID(), std::format("lights[{}].quadratic", i).c_str());
-        glUniform1f(lightQuadraticLoc, lights[i]->quadratic);
+        glVertexAttribPointer(INSTANCE_COLOR_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)sizeof(glm::mat4));
+        glEnableVertexAttribArray(INSTANCE_COLOR_LOCATION);
+        glVertexAttribDivisor(INSTANCE_COLOR_LOCATION, 1);
+        glVertexAttribPointer(INSTANCE_MATERIAL_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(sizeof(glm::mat4) + sizeof(glm::vec3)));
+        glEnableVertexAttribArray(INSTANCE_MATERIAL_LOCATION);
+        glVertexAttribDivisor(INSTANCE_MATERIAL_LOCATION, 1);
     }
-    unsigned int lightsCountLoc = glGetUniformLocation(m_shader->getID(), "lightsCount");
-    glUniform1i(lightsCountLoc, lightsSize);
 
-    unsigned int cameraPosLoc = glGetUniformLocation(m_shader->getID(), "cameraPos");
-    glm::vec3 camPos = renderEngineInstance.getCameraPos();
-    glUniform3fv(cameraPosLoc, 1, glm::value_ptr(camPos));
+    if(m_mesh.indicesLength)
+        glDrawElementsInstanced(GL_TRIANGLES, m_mesh.indicesLength, GL_UNSIGNED_INT, 0, instances.size());
+    else glDrawArraysInstanced(GL_TRIANGLES, 0, m_mesh.vertexCount, instances.size());
 }
-
 void LitObject::draw() const
 {
-    m_shader->use();
-    LitObject::configureShaders();
-    Object3D::configureShaders();
-    drawMesh();
+    InstanceData instance {getInstanceData()};
+    drawInstances({&instance, 1});
 }
 
 UnlitObject::UnlitObject(Mesh mesh, glm::vec3 color, bool useTime)
     : Object3D(mesh, ShaderManager::getInstance().getShader(assets::SHADERS_VSIMPLE_GLSL,
-    assets::SHADERS_FSIMPLEUNLIT_GLSL), useTime), ColorSetterInterface(color) {}
+    assets::SHADERS_FSIMPLEUNLIT_GLSL), useTime), ColorSetterInterface(color), m_colorUniform(m_shader->getUniform<glm::vec3>("color")) {}
 
 Object2D::Object2D(Mesh mesh, Shader* shader, glm::vec3 color, bool useTime)
-        : Object(mesh, shader, useTime), ColorSetterInterface(color) {}
+        : Object(mesh, shader, useTime, ObjectKinds::object2D), ColorSetterInterface(color), m_colorUniform(shader->getUniform<glm::vec3>("color")),
+        m_modelUniform(shader->getUniform<glm::mat4>("model")) {}
 
+std::uint32_t UnlitObject::getMaterialKey() const
+{
+    //8 bits per channel is enough to group the same colors
+    auto channel = [](float value) {return static_cast<std::uint32_t>(std::clamp(value, 0.f, 1.f) * 255.f);};
+    return channel(m_color.x) << 16 | channel(m_color.y) << 8 | channel(m_color.z);
+}
 void UnlitObject::configureShaders() const
 {
-    unsigned int colorLoc = glGetUniformLocation(m_shader->getID(), "color");
-    glUniform3fv(colorLoc, 1, glm::value_ptr(m_color));
+    m_colorUniform.set(m_color);
 }
 void UnlitObject::draw() const
 {
@@ -156,10 +170,8 @@ void UnlitObject::draw() const
 
 void Object2D::configureShaders() const 
 {
-    unsigned int colorLoc = glGetUniformLocation(m_shader->getID(), "color");
-    unsigned int modelLoc = glGetUniformLocation(m_shader->getID(), "model");
-    glUniform3fv(colorLoc, 1, glm::value_ptr(m_color));
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(m_model));
+    m_colorUniform.set(m_color);
+    m_modelUniform.set(m_model);
 }
 
 void Object2D::draw() const
@@ -0,0 +1,142 @@
+#include <fstream>
+#include <format>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <glad/glad.h>
+
+#include <engine/profiler.hpp>
+
+std::int64_t Profiler::getMicroseconds(Clock::time_point time) const
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(time - m_startTime).count();
+}
+void Profiler::setEnabled(bool enabled)
+{
+    if(enabled && !m_enabled)
+    {
+        m_startTime = m_frameStart = Clock::now();
+        m_cpuHistories = {};
+        m_gpuHistories = {};
+    }
+    m_enabled = enabled;
+}
+void Profiler::setOverlayEnabled(bool enabled)
+{
+    m_overlayEnabled = enabled;
+    //a running trace keeps it measuring
+    setEnabled(enabled || m_tracing);
+}
+void Profiler::startTrace()
+{
+    setEnabled(true);
+    m_tracing = true;
+    m_traceEvents.clear();
+}
+bool Profiler::writeTrace(const std::string& path)
+{
+    std::ofstream file(path);
+    if(!file) return false;
+    file << "{\"traceEvents\":[";
+    for(std::size_t i {}; i < m_traceEvents.size(); ++i)
+    {
+        const TraceEvent& event = m_traceEvents[i];
+        file << (i ? ",\n" : "\n") << std::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{},"dur":{},"pid":1,"tid":{}}})",
+            PROFILE_SECTION_NAMES[static_cast<std::size_t>(event.section)], event.gpu ? "gpu" : "cpu", event.start, event.duration, event.gpu ? 2 : 1);
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}";
+    m_tracing = false;
+    m_traceEvents.clear();
+    return static_cast<bool>(file);
+}
+
+void Profiler::beginFrame()
+{
+    if(!m_enabled) return;
+    Clock::time_point now {Clock::now()};
+    if(m_frame) addSample(ProfileSections::frame, m_frameStart, now);
+    m_frameStart = now;
+
+    if(!m_queriesCreated)
+    {
+        for(auto& frameQueries : m_queries)
+            for(auto& query : frameQueries) glGenQueries(1, &query.query);
+        m_queriesCreated = true;
+    }
+    ++m_frame;
+    //the queries of this frame were issued QUERY_FRAMES frames ago
+    collectGpuQueries(m_frame % QUERY_FRAMES);
+}
+void Profiler::collectGpuQueries(std::size_t frame)
+{
+    for(std::size_t section {}; section < PROFILE_SECTIONS_COUNT; ++section)
+    {
+        GpuQuery& query = m_queries[frame][section];
+        if(!query.issued) continue;
+        query.issued = false;
+        int available {};
+        glGetQueryObjectiv(query.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if(!available) continue;//dropped rather than stalling the pipeline
+        std::uint64_t nanoseconds {};
+        glGetQueryObjectui64v(query.query, GL_QUERY_RESULT, &nanoseconds);
+        m_gpuHistories[section].add(nanoseconds / 1e6f);
+        if(m_tracing && m_traceEvents.size() < MAX_TRACE_EVENTS)
+            m_traceEvents.push_back({static_cast<ProfileSections>(section), true, getMicroseconds(query.start), static_cast<std::int64_t>(nanoseconds / 1000)});
+    }
+}
+void Profiler::addSample(ProfileSections section, Clock::time_point start, Clock::time_point end)
+{
+    if(!m_enabled) return;
+    m_cpuHistories[static_cast<std::size_t>(section)].add(std::chrono::duration<float, std::milli>(end - start).count());
+    if(m_tracing && m_traceEvents.size() < MAX_TRACE_EVENTS)
+        m_traceEvents.push_back({section, false, getMicroseconds(start), getMicroseconds(end) - getMicroseconds(start)});
+}
+void Profiler::beginGpuSection(ProfileSections section)
+{
+    if(!m_enabled || !m_queriesCreated) return;
+    if(m_gpuSection) endGpuSection();
+    GpuQuery& query = m_queries[m_frame % QUERY_FRAMES][static_cast<std::size_t>(section)];
+    if(query.issued) return;//measured once per frame
+    glBeginQuery(GL_TIME_ELAPSED, query.query);
+    query.issued = true;
+    query.start = Clock::now();
+    m_gpuSection = section;
+}
+void Profiler::endGpuSection()
+{
+    if(!m_gpuSection) return;
+    glEndQuery(GL_TIME_ELAPSED);
+    m_gpuSection.reset();
+}
+ProfileStatistics Profiler::getStatistics(ProfileSections section, bool gpu) const
+{
+    return (gpu ? m_gpuHistories : m_cpuHistories)[static_cast<std::size_t>(section)].getStatistics();
+}
+std::string Profiler::getOverlayText() const
+{
+    std::string returnValue {"MS               MIN   AVG   P99"};
+    auto addLine = [&](std::string_view name, const ProfileStatistics& statistics)
+    {
+        if(!statistics.samples) return;
+        returnValue += std::format("\n{:<15}{:6.2f}{:6.2f}{:6.2f}", name, statistics.min, statistics.average, statistics.p99);
+    };
+    static constexpr std::array<const char*, PROFILE_SECTIONS_COUNT> SHORT_NAMES
+        {"FRAME", "RENDER", "GAME", "UI", "NORMAL", "NO DEPTH", "LASTLY", "2D", "CALLBACKS"};
+    for(std::size_t section {}; section < PROFILE_SECTIONS_COUNT; ++section)
+        addLine(SHORT_NAMES[section], m_cpuHistories[section].getStatistics());
+    for(std::size_t section {static_cast<std::size_t>(ProfileSections::normalPass)}; section < PROFILE_SECTIONS_COUNT; ++section)
+        addLine(std::format("GPU {}", SHORT_NAMES[section]), m_gpuHistories[section].getStatistics());
+    return returnValue;
+}
+
+ProfileScope::ProfileScope(ProfileSections section) : m_section(section)
+{
+    static Profiler& profilerInstance = Profiler::getInstance();
+    if(profilerInstance.isEnabled()) m_start = Profiler::Clock::now();
+}
+ProfileScope::~ProfileScope()
+{
+    static Profiler& profilerInstance = Profiler::getInstance();
+    if(m_start) profilerInstance.addSample(m_section, *m_start, Profiler::Clock::now());
+}
\ No newline at end of file
@@ -3,6 +3,10 @@
 #include <algorithm>
 #include <utility>
 #include <cassert>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -11,8 +15,54 @@
 #include <engine/renderEngine.hpp>
 #include <engine/object.hpp>
 #include <engine/sceneLighting.hpp>
+#include <engine/shader.hpp>
 #include <glfwController.hpp>
 #include <engine/camera.hpp>
+#include <engine/profiler.hpp>
+
+//the std140 layouts of the uniform blocks in the shaders
+struct CameraBlock
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec3 position;
+    float padding;
+};
+struct PointLightBlock
+{
+    glm::vec3 color;
+    float strength;
+    glm::vec3 position;
+    float linear;
+    float quadratic;
+    float padding[3];
+};
+struct DirectionalLightBlock
+{
+    glm::vec3 color;
+    float padding;
+    glm::vec3 direction;
+    float strength;
+};
+struct LightingBlock
+{
+    DirectionalLightBlock directionalLight;
+    std::array<PointLightBlock, MAX_POINT_LIGHTS_LENGTH> lights;
+    int lightsCount;
+    float padding[3];
+};
+static_assert(sizeof(CameraBlock) == 144 && sizeof(PointLightBlock) == 48 && sizeof(DirectionalLightBlock) == 32);
+static_assert(sizeof(LightingBlock) == 32 + 48 * MAX_POINT_LIGHTS_LENGTH + 16);
+
+static unsigned int createUniformBlockBuffer(UniformBlocks block, std::size_t size)
+{
+    unsigned int buffer {};
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, static_cast<unsigned int>(block), buffer);
+    return buffer;
+}
 
 RenderEngine::RenderEngine()
 {
@@ -25,87 +75,163 @@ RenderEngine::RenderEngine()
     }
 
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    m_cameraBlockBuffer = createUniformBlockBuffer(UniformBlocks::camera, sizeof(CameraBlock));
+    m_lightingBlockBuffer = createUniformBlockBuffer(UniformBlocks::lighting, sizeof(LightingBlock));
 }
 RenderEngine::~RenderEngine() {}
 
 void RenderEngine::update()
 {
+    static Profiler& profilerInstance = Profiler::getInstance();
+    ProfileScope scope(ProfileSections::renderEngine);
     glClearColor(m_backgroundColor.x, m_backgroundColor.y, m_backgroundColor.z, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
     assert(m_camera && "A camera must be assigned to the RenderEngine before rendering starts");
     m_camera->update();
-
-    glEnable(GL_DEPTH_TEST); 
-    for(auto object : m_objects3DNormal)
-    {
-        object->draw();
-    }
-    glDisable(GL_DEPTH_TEST);
-    for(auto object : m_objects3DnoDepth)
+    if(m_camera->isMoving())
     {
-        object->draw();
+        static GLFWController& glfwControllerInstance = GLFWController::getInstance();
+        glfwControllerInstance.requestRedraw();
     }
-    glEnable(GL_DEPTH_TEST); 
-    for(auto object : m_objects3Dlastl)
+    updateUniformBlocks();
+
+    m_boundProgram = m_boundVAO = UNKNOWN_BINDING;
+    m_statistics = {};
+
+    m_renderQueue.clear();
+    m_drawables.clear();
+    for(std::size_t pass {}; pass < PASSES_COUNT; ++pass)
+        queueObjects(static_cast<RenderPasses>(pass));
+    m_renderQueue.sort();
+
+    std::optional<bool> depthTest;
+    std::optional<RenderPasses> currentPass;
+    std::optional<ProfileScope> passScope;
+    for(auto& item : m_renderQueue.getItems())
     {
-        object->draw();
+        RenderPasses pass {RenderQueue::getPass(item.key)};
+        if(pass != currentPass)
+        {
+            currentPass = pass;
+            passScope.reset();
+            passScope.emplace(getPassSection(pass));
+            profilerInstance.beginGpuSection(getPassSection(pass));
+        }
+        bool passDepthTest {pass == RenderPasses::normal || pass == RenderPasses::renderLastly};
+        if(depthTest != passDepthTest)
+        {
+            if(passDepthTest) glEnable(GL_DEPTH_TEST);
+            else glDisable(GL_DEPTH_TEST);
+            depthTest = passDepthTest;
+            ++m_statistics.depthTestChanges;
+        }
+        const Drawable& drawable {m_drawables[item.index]};
+        if(drawable.batch) drawBatch(*drawable.batch);
+        else drawable.object->draw();
     }
+    passScope.reset();
     glDisable(GL_DEPTH_TEST);
-    for(auto object : m_objects2D)
     {
-        object->draw();
+        ProfileScope callbacksScope(ProfileSections::callbacksPass);
+        profilerInstance.beginGpuSection(ProfileSections::callbacksPass);
+        for(auto& callback : m_renderCallbacks)
+            callback();
+        profilerInstance.endGpuSection();
     }
-    for(auto& callback : m_renderCallbacks)
-        callback();
+    m_lastStatistics = m_statistics;
 }
+void RenderEngine::updateUniformBlocks()
+{
+    CameraBlock camera {m_camera->getView(), m_camera->getProjection(), m_camera->getPosition()};
+    glBindBuffer(GL_UNIFORM_BUFFER, m_cameraBlockBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(camera), &camera);
 
-void RenderEngine::addObject(Object* objPtr, Object3DRenderTypes renderType)
+    SceneLighting* lighting {getLighting()};
+    LightingBlock lightingBlock {};
+    if(auto dirLight = lighting->getDirectionalLight())
+        lightingBlock.directionalLight = {dirLight->color, {}, dirLight->direction, dirLight->strength};
+    auto& lights {lighting->getPointLights()};
+    lightingBlock.lightsCount = static_cast<int>(std::min(lights.size(), lightingBlock.lights.size()));
+    for(int i {}; i < lightingBlock.lightsCount; ++i)
+        lightingBlock.lights[i] = {lights[i]->color, lights[i]->strength, lights[i]->position, lights[i]->linear, lights[i]->quadratic};
+    glBindBuffer(GL_UNIFORM_BUFFER, m_lightingBlockBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(lightingBlock), &lightingBlock);
+}
+void RenderEngine::queueObjects(RenderPasses pass)
 {
-    auto processObjectsVector = [objPtr](std::vector<Object*>& objects)
+    std::size_t passIndex {static_cast<std::size_t>(pass)};
+    //without the depth test the later objects are drawn on top, so the order they were added in is kept
+    bool sortByState {pass == RenderPasses::normal || pass == RenderPasses::renderLastly};
+    auto queue = [&](const Object* object, std::uint32_t order, std::uint32_t material, const InstanceBatch* batch)
     {
-        if(std::find(objects.begin(), objects.end(), objPtr) == objects.end())
-            objects.push_back(objPtr);
+        std::uint32_t index {static_cast<std::uint32_t>(m_drawables.size())};
+        m_renderQueue.add(sortByState ? RenderQueue::createKey(pass, object->getShader()->getID(), object->getMesh().VAO, material)
+            : RenderQueue::createOrderedKey(pass, order), index);
+        m_drawables.push_back({object, batch});
     };
-    if(!dynamic_cast<const Object3D*>(objPtr))
+    for(auto& entry : m_objects[passIndex])
     {
-        processObjectsVector(m_objects2D);
-        return;
+        if(entry.object->isVisible())
+            queue(entry.object, entry.order, entry.object->getMaterialKey(), nullptr);
     }
-    switch(renderType)
+    //the materials of the batches are in the instance data
+    for(auto& [key, batch] : m_batches[passIndex])
     {
-        using enum Object3DRenderTypes; 
-    case normal:
-        processObjectsVector(m_objects3DNormal);
-        break;
-    case noDepthTest:
-        processObjectsVector(m_objects3DnoDepth);
-    case renderLastly:
-        processObjectsVector(m_objects3Dlastl);
+        if(!batch.objects.empty())
+            queue(batch.objects.begin()->object, batch.order, 0, &batch);
     }
 }
-void RenderEngine::removeObject(Object* objPtr, Object3DRenderTypes renderType)
+void RenderEngine::drawBatch(const InstanceBatch& batch)
 {
-    auto processObjectsVector = [objPtr](std::vector<Object*>& objects)
-    {
-        objects.erase(std::find(objects.begin(), objects.end(), objPtr));
-    };
-    if(!dynamic_cast<const Object3D*>(objPtr))
+    //only lit objects are added to the batches
+    m_instanceData.clear();
+    for(auto& entry : batch.objects)
     {
-        processObjectsVector(m_objects2D);
-        return;
+        if(entry.object->isVisible())
+            m_instanceData.push_back(static_cast<const LitObject*>(entry.object)->getInstanceData());
     }
-    switch(renderType)
+    if(m_instanceData.empty()) return;
+    //the shared uniforms are the same for every object of the batch
+    static_cast<const LitObject*>(batch.objects.begin()->object)->drawInstances(m_instanceData);
+}
+
+RenderHandle RenderEngine::addObject(const Object* object, Object3DRenderTypes renderType)
+{
+    RenderPasses pass {RenderPasses::overlay2D};
+    if(object->getKind() != ObjectKinds::object2D)
     {
-    case Object3DRenderTypes::normal:
-        processObjectsVector(m_objects3DNormal);
-        break;
-    case Object3DRenderTypes::noDepthTest:
-        processObjectsVector(m_objects3DnoDepth);
-    case Object3DRenderTypes::renderLastly:
-        processObjectsVector(m_objects3Dlastl);
+        switch(renderType)
+        {
+            using enum Object3DRenderTypes;
+        case normal:
+            pass = RenderPasses::normal;
+            break;
+        case noDepthTest:
+            pass = RenderPasses::noDepthTest;
+            break;
+        case renderLastly:
+            pass = RenderPasses::renderLastly;
+            break;
+        }
     }
+    std::size_t passIndex {static_cast<std::size_t>(pass)};
+    RenderEntry entry {object, m_nextOrder++};//wraps only after billions of additions
+    if(object->getKind() != ObjectKinds::lit)
+        return {&m_objects[passIndex], m_objects[passIndex].insert(entry)};
+
+    std::uint64_t batchKey {static_cast<std::uint64_t>(object->getShader()->getID()) << 32 | object->getMesh().VAO};
+    auto [batch, created] = m_batches[passIndex].try_emplace(batchKey);
+    if(created) batch->second.order = entry.order;
+    //the map's elements don't move, so the handle can point to the batch
+    return {&batch->second.objects, batch->second.objects.insert(entry)};
+}
+void RenderEngine::removeObject(RenderHandle& handle)
+{
+    assert(handle.isValid() && "The object isn't in the RenderEngine");
+    handle.slots->erase(handle.slot);
+    handle = {};
 }
 
 void RenderEngine::setLighting(SceneLighting&& lighting)
@@ -137,6 +263,34 @@ glm::mat4 RenderEngine::getView() const
     return m_camera->getView();
 }
 
+void RenderEngine::useProgram(unsigned int program)
+{
+    if(program == m_boundProgram)
+    {
+        ++m_statistics.skippedChanges;
+        return;
+    }
+    glUseProgram(program);
+    m_boundProgram = program;
+    ++m_statistics.shaderChanges;
+}
+void RenderEngine::bindVertexArray(unsigned int VAO)
+{
+    if(VAO == m_boundVAO)
+    {
+        ++m_statistics.skippedChanges;
+        return;
+    }
+    glBindVertexArray(VAO);
+    m_boundVAO = VAO;
+    ++m_statistics.meshChanges;
+}
+void RenderEngine::countDraw(int instances)
+{
+    ++m_statistics.draws;
+    m_statistics.instances += instances;
+}
+
 void RenderEngine::onWindowResize(int width, int height)
 {
     glViewport(0, 0, width, height);
@@ -0,0 +1,39 @@
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+#include <engine/renderQueue.hpp>
+
+std::uint64_t RenderQueue::createKey(RenderPasses pass, unsigned int shader, unsigned int mesh, std::uint32_t material)
+{
+    assert(shader < 1u << (PASS_SHIFT - SHADER_SHIFT) && mesh < 1u << (SHADER_SHIFT - MESH_SHIFT) && "The OpenGL names don't fit into the key");
+    return static_cast<std::uint64_t>(pass) << PASS_SHIFT | static_cast<std::uint64_t>(shader) << SHADER_SHIFT
+        | static_cast<std::uint64_t>(mesh) << MESH_SHIFT | material;
+}
+std::uint64_t RenderQueue::createOrderedKey(RenderPasses pass, std::uint32_t order)
+{
+    return static_cast<std::uint64_t>(pass) << PASS_SHIFT | order;
+}
+void RenderQueue::sort()
+{
+    //least significant digit radix sort, one byte at a time
+    if(m_items.size() < 2) return;
+    m_buffer.resize(m_items.size());
+    for(int shift {}; shift < 64; shift += 8)
+    {
+        std::array<std::uint32_t, 256> offsets {};
+        for(auto& item : m_items) ++offsets[item.key >> shift & 0xff];
+        //the byte is the same in every key, e.g. the unused high bits of the names
+        if(offsets[m_items.front().key >> shift & 0xff] == m_items.size()) continue;
+
+        std::uint32_t offset {};
+        for(auto& count : offsets)
+        {
+            std::uint32_t bucketSize {count};
+            count = offset;
+            offset += bucketSize;
+        }
+        for(auto& item : m_items) m_buffer[offsets[item.key >> shift & 0xff]++] = item;
+        m_items.swap(m_buffer);
+    }
+}
\ No newline at end of file
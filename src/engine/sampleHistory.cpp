@@ -0,0 +1,29 @@
+#include <algorithm>
+#include <cstddef>
+
+#include <engine/sampleHistory.hpp>
+
+void SampleHistory::add(float sample)
+{
+    m_samples[m_next] = sample;
+    m_next = (m_next + 1) % LENGTH;
+    m_count = std::min(m_count + 1, LENGTH);
+}
+float SampleHistory::getAverage() const
+{
+    if(!m_count) return 0.f;
+    float sum {};
+    for(std::size_t i {}; i < m_count; ++i) sum += m_samples[i];
+    return sum / m_count;
+}
+SampleStatistics SampleHistory::getStatistics() const
+{
+    if(!m_count) return {};
+    std::array<float, LENGTH> sorted {m_samples};
+    std::sort(sorted.begin(), sorted.begin() + m_count);
+    auto getPercentile = [&](std::size_t percentile)
+    {
+        return sorted[std::min(m_count - 1, m_count * percentile / 100)];
+    };
+    return {sorted[0], getAverage(), getPercentile(50), getPercentile(95), getPercentile(99), m_count};
+}
\ No newline at end of file
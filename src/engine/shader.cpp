@@ -7,6 +7,7 @@
 
 #include <engine/shader.hpp>
 #include <engine/sceneLighting.hpp>
+#include <engine/renderEngine.hpp>
 
 #ifndef NDEBUG
 void checkCompileErrors(unsigned int shader, std::string_view type);
@@ -40,6 +41,45 @@ Shader::Shader(std::string_view vertexString, std::string_view fragmentString)
 #endif
     glDeleteShader(vertex);
     glDeleteShader(fragment);
+    resolveUniforms();
+}
+void Shader::use() const
+{
+    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    renderEngineInstance.useProgram(m_id);
+}
+void Shader::resolveUniforms()
+{
+    for(unsigned int binding {}; binding < UNIFORM_BLOCK_NAMES.size(); ++binding)
+    {
+        unsigned int blockIndex {glGetUniformBlockIndex(m_id, UNIFORM_BLOCK_NAMES[binding])};
+        if(blockIndex != GL_INVALID_INDEX) glUniformBlockBinding(m_id, blockIndex, binding);
+    }
+
+    int uniformCount {};
+    glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &uniformCount);
+    char name[256];
+    for(int i {}; i < uniformCount; ++i)
+    {
+        int length {}, size {};
+        GLenum type {};
+        glGetActiveUniform(m_id, i, sizeof(name), &length, &size, &type, name);
+        std::string uniformName(name, length);
+        int location {glGetUniformLocation(m_id, uniformName.c_str())};
+        if(location == -1) continue;//e.g. in a uniform block
+        m_uniformLocations.emplace(uniformName, location);
+        //arrays of basic types are listed once as "name[0]"
+        if(size > 1 && uniformName.ends_with("[0]"))
+        {
+            std::string arrayName {uniformName.substr(0, uniformName.size() - 3)};
+            m_uniformLocations.emplace(arrayName, location);
+            for(int element {1}; element < size; ++element)
+            {
+                std::string elementName {arrayName + '[' + std::to_string(element) + ']'};
+                m_uniformLocations.emplace(elementName, glGetUniformLocation(m_id, elementName.c_str()));
+            }
+        }
+    }
 }
 #ifndef NDEBUG
 void checkCompileErrors(unsigned int shader, std::string_view type)
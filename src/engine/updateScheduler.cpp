@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <utility>
+
+#include <engine/updateScheduler.hpp>
+
+static constexpr std::size_t INITIAL_CAPACITY {64};
+
+UpdateScheduler::UpdateScheduler()
+{
+    m_tasks.reserve(INITIAL_CAPACITY);
+    m_order.reserve(INITIAL_CAPACITY);
+    m_freeTasks.reserve(INITIAL_CAPACITY);
+    m_pending.reserve(INITIAL_CAPACITY);
+}
+UpdateHandle UpdateScheduler::add(UpdateFunction&& function, std::string_view name, UpdatePriorities priority)
+{
+    Task task {std::move(function), name, priority, m_nextId++};
+    UpdateHandle returnValue {task.id};
+    //the pool can't grow while one of its tasks runs
+    if(m_running) m_pending.push_back(std::move(task));
+    else insert(std::move(task));
+    return returnValue;
+}
+void UpdateScheduler::insert(Task&& task)
+{
+    std::uint32_t index {};
+    if(m_freeTasks.empty())
+    {
+        index = static_cast<std::uint32_t>(m_tasks.size());
+        m_tasks.push_back(std::move(task));
+    }
+    else
+    {
+        index = m_freeTasks.back();
+        m_freeTasks.pop_back();
+        m_tasks[index] = std::move(task);
+    }
+    //after the tasks of the same priority, so they run in the order they were added
+    auto position = std::upper_bound(m_order.begin(), m_order.end(), m_tasks[index].priority, [this](UpdatePriorities priority, std::uint32_t other)
+    {
+        return priority < m_tasks[other].priority;
+    });
+    m_order.insert(position, index);
+}
+void UpdateScheduler::remove(UpdateHandle handle)
+{
+    for(Task& task : m_pending)
+        if(task.id == handle.id) task.removed = true;
+    for(std::uint32_t index : m_order)
+    {
+        if(m_tasks[index].id != handle.id) continue;
+        m_tasks[index].removed = true;
+        m_changed = true;
+    }
+    if(!m_running) collect();
+}
+bool UpdateScheduler::contains(UpdateHandle handle) const
+{
+    auto matches = [handle](const Task& task){return task.id == handle.id && !task.removed;};
+    return std::any_of(m_pending.begin(), m_pending.end(), matches)
+        || std::any_of(m_order.begin(), m_order.end(), [&](std::uint32_t index){return matches(m_tasks[index]);});
+}
+void UpdateScheduler::run(float deltaTime)
+{
+    m_running = true;
+    for(std::uint32_t index : m_order)
+    {
+        Task& task = m_tasks[index];
+        if(task.removed) continue;
+        bool finished {};
+        if(m_timing)
+        {
+            Clock::time_point start {Clock::now()};
+            finished = task.function(deltaTime);
+            addTime(task.name, Clock::now() - start);
+        }
+        else finished = task.function(deltaTime);
+        if(finished)
+        {
+            task.removed = true;
+            m_changed = true;
+        }
+    }
+    m_running = false;
+    m_time += deltaTime;
+    collect();
+}
+void UpdateScheduler::collect()
+{
+    if(m_changed)
+    {
+        std::erase_if(m_order, [this](std::uint32_t index)
+        {
+            Task& task = m_tasks[index];
+            if(!task.removed) return false;
+            task.function.reset();
+            task.id = 0;
+            m_freeTasks.push_back(index);
+            return true;
+        });
+        m_changed = false;
+    }
+    for(Task& task : m_pending)
+        if(!task.removed) insert(std::move(task));
+    m_pending.clear();
+}
+void UpdateScheduler::setTimingEnabled(bool enabled)
+{
+    if(enabled && !m_timing) m_statistics.clear();
+    m_timing = enabled;
+}
+void UpdateScheduler::addTime(std::string_view name, Clock::duration duration)
+{
+    float milliseconds = std::chrono::duration<float, std::milli>(duration).count();
+    auto statistics = std::find_if(m_statistics.begin(), m_statistics.end(), [name](const UpdateStatistics& other){return other.name == name;});
+    if(statistics == m_statistics.end()) statistics = m_statistics.insert(m_statistics.end(), {name});
+    ++statistics->runs;
+    statistics->total += milliseconds;
+    statistics->max = std::max(statistics->max, milliseconds);
+}
\ No newline at end of file
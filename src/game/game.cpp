@@ -1,26 +1,26 @@
 #include <iterator>
 #include <algorithm>
-#include <cmath>
-#include <limits>
+#include <bitset>
 #include <format>
+#include <chrono>
 
 #include <glm/gtc/quaternion.hpp>
 #include <glm/glm.hpp>
 
 #include <engine/object.hpp>
 #include <game/gridObject.hpp>
+#include <game/gameObjectPool.hpp>
 #include <game/action.hpp>
 #include <game/game.hpp>
 #include <engine/renderEngine.hpp>
 #include <engine/shaderManager.hpp>
 #include <game/uiManager.hpp>
-#include <game/random.hpp>
 #include <game/uiPreset.hpp>
 #include <engine/camera.hpp>
 #include <assets.hpp>
 #include <glfwController.hpp>
 
-bool GameGrid::update(float deltaTime)
+bool GameGridView::update(float deltaTime)
 {
     constexpr auto addY = [](glm::vec3 vec, float y) -> glm::vec3
     {
@@ -39,6 +39,7 @@ bool GameGrid::update(float deltaTime)
             {
                 if(moveData.resetRotationOnEnd) moveData.moveObject->setRotation({});
                 moveData.moveObject->setPosition(addY(moveData.lastPos, y));
+                moveData.moveObject->endInterpolation();
                 moveData.moveObject = nullptr;
                 continue;
             }
@@ -54,7 +55,7 @@ bool GameGrid::update(float deltaTime)
         }
         float ratio = moveData.currentTime / moveData.speed;
         float otherRatio = 1.f - ratio;
-        auto currentPos = 
+        auto currentPos =
             moveData.lastPos * ratio + gridLocationToPosition(moveData.path.front()) * otherRatio;
         moveData.moveObject->setPosition(addY(currentPos, y));
     }
@@ -63,215 +64,65 @@ bool GameGrid::update(float deltaTime)
     if(m_movements.empty()) return true;
     return false;
 }
-GameGrid::GameGrid(Game* gameInstance) : m_gameInstance(gameInstance) {}
-GridObject* GameGrid::at(std::size_t x, std::size_t y) const
+GameGridView::GameGridView(Game* gameInstance) : m_gameInstance(gameInstance) {}
+GameGridView::~GameGridView()
 {
-    return this->operator[](x + y * GRID_SIZE).first;
+    static GameController& gameControllerInstance = GameController::getInstance();
+    gameControllerInstance.removeUpdateFunction(m_movementsUpdate);
+    //the moved objects can outlive the view, e.g. the pooled missiles
+    for(auto& movement : m_movements) movement.moveObject->endInterpolation();
 }
-GridObject* GameGrid::at(Loc loc) const
+const GameGrid& GameGridView::getGrid() const
 {
-    return this->operator[](loc.first + loc.second * GRID_SIZE).first;
+    return m_gameInstance->getMatch().getGameGrid();
 }
-void GameGrid::destroy(GridObject* ptr)
+GridObject* GameGridView::create(std::size_t index, UnitTypes type, Team team)
 {
-    for(auto it = m_combinedLocations.begin(); it != m_combinedLocations.end(); ++it)
-    {
-        if(it->second->get() == ptr)
-        {
-            it->second->reset();
-            m_combinedLocations.erase(it);
-            return;
-        }
-    }
-    std::find_if(m_base.begin(), m_base.end(), [ptr](auto& unitObject) -> bool
-    {
-        return unitObject.get() == ptr;
-    })->reset();
+    auto& ptr = m_objects[index];
+    ptr = createGridObject(m_gameInstance, type, team);
+    auto [x, y] = GameGrid::convertIndexToLocation(index);
+    if(getUnitDefinition(type).large)
+        ptr->setPosition({-1.f + SQUARE_SIZE * x + SQUARE_SIZE, 0.f,
+            -1.f + SQUARE_SIZE * y + SQUARE_SIZE});
+    else ptr->setPosition(gridLocationToPosition(std::make_pair(x, y)));
+    return ptr.get();
 }
-void GameGrid::destroyAt(Loc loc)
+void GameGridView::destroy(std::size_t index)
 {
-    destroyAt(loc.first + loc.second * GRID_SIZE);
+    m_objects[index].reset();
 }
-void GameGrid::destroyAt(std::size_t index)
+GridObject* GameGridView::relocate(std::size_t from, std::size_t to)
 {
-    for(auto it = m_combinedLocations.begin(); it != m_combinedLocations.end(); ++it)
-    {
-        if(std::find(it->first.begin(), it->first.end(), index) != it->first.end())
-        {
-            it->second->reset();
-            m_combinedLocations.erase(it);
-            return;
-        }
-    }
-
-    m_base[index].reset();
+    if(from == to) return m_objects[to].get();
+    m_objects[to] = std::move(m_objects[from]);
+    return m_objects[to].get();
 }
-void GameGrid::moveAt(std::size_t x1, std::size_t y1, std::size_t x2, std::size_t y2)
+GridObject* GameGridView::at(std::size_t x, std::size_t y) const
 {
-    auto& startPtr = m_base[x1 + y1 * GRID_SIZE], & movePtr = m_base[x2 + y2 * GRID_SIZE];
-    assert(dynamic_cast<Base*>(startPtr.get()) && "Base cannot be moved");
-    assert(dynamic_cast<Base*>(movePtr.get()) && "Base cannot be destroyed by moving");
-    movePtr = std::move(startPtr);
-    startPtr.reset();
-    movePtr->setPosition(gridLocationToPosition(std::make_pair(x2, y2)));
+    return at(std::make_pair(x, y));
 }
-void GameGrid::moveAt(Loc loc1, Loc loc2)
+GridObject* GameGridView::at(Loc loc) const
 {
-    moveAt(loc1.first, loc1.second, loc2.first, loc2.second); 
+    const GameGrid& grid = getGrid();
+    const GridCell* cell = grid.at(loc);
+    if(!cell) return nullptr;
+    return m_objects[grid.getAnchorIndex(cell)].get();
 }
-GameGrid::Path GameGrid::findPath(Loc startLoc, Loc moveLoc, bool avoidObstacles)//A*
-{
-    if(startLoc == moveLoc)
-    {
-        Path returnValue;
-        returnValue.push_front(startLoc);
-        return returnValue;
-    }
-    struct PathNode
-    {
-        int gCost {std::numeric_limits<int>::max()};
-        int hCost {};
-        int fCost {};
-        Loc loc;
-        PathNode* parentNode {};
-        void calculateFCost()
-        {
-            fCost = hCost + gCost;
-        }
-    };
-    struct ComparePathNodes
-    {
-        bool operator()(const PathNode* lhs, const PathNode* rhs) const
-        {
-            return lhs->fCost < rhs->fCost;
-        }
-    };
-    
-    static constexpr int MOVE_STRAIGHT_COST = 10;
-    static constexpr int MOVE_DIAGONAL_COST = 14;
-    auto calculateDistanceCost = [](PathNode* pathNode1, PathNode* pathNode2) -> int
-    {
-        int xDistance = std::abs(static_cast<int>(pathNode1->loc.first) - static_cast<int>(pathNode2->loc.first));
-        int yDistance = std::abs(static_cast<int>(pathNode1->loc.second) - static_cast<int>(pathNode2->loc.second));
-        return MOVE_DIAGONAL_COST * std::min(xDistance, yDistance) + MOVE_STRAIGHT_COST * std::abs(xDistance - yDistance);
-    };
-    
-    auto validLocIndex = [](int x) -> bool {return x < GRID_SIZE && x >= 0;};
-    
-    std::array<std::unique_ptr<PathNode>, GRID_SIZE * GRID_SIZE> nodes;
-
-    auto initializeNode = [&nodes](Loc loc) -> PathNode*
-    {
-        std::size_t index = loc.first + loc.second * GRID_SIZE;
-        auto node = std::make_unique<PathNode>(); 
-        node->calculateFCost();
-        node->loc = loc;
-        nodes[index] = std::move(node);
-        return nodes[index].get();
-    };
-
-    PathNode* startNode {};
-    std::size_t startNodeIndex = convertLocationToIndex(startLoc);
-    nodes[startNodeIndex] = std::make_unique<PathNode>();
-    startNode = nodes[startNodeIndex].get();
-    startNode->loc = startLoc;
-    startNode->gCost = 0;
-
-    startNode = nodes[startNodeIndex].get();
-    startNode->loc = startLoc;
-    PathNode* endNode = initializeNode(moveLoc);
-
-    startNode->hCost = calculateDistanceCost(startNode, endNode);
-    startNode->calculateFCost();
-
-    std::set<PathNode*, ComparePathNodes> openList;
-    openList.insert(startNode);
-    std::unordered_set<PathNode*> closedList;
-
-    GridObject* startLocObject = at(startLoc), * moveLocUnit = at(moveLoc);//not considered as an obstacle
-    while (!openList.empty())
-    {
-        auto currentNode = *openList.begin();
-        //found
-        if(currentNode == endNode)
-        {
-            Path returnValue;
-            returnValue.push_front(currentNode->loc);
-            while (currentNode->parentNode != nullptr)
-            {
-                currentNode = currentNode->parentNode;
-                returnValue.push_front(currentNode->loc);
-            }
-            return returnValue;
-        }
-        openList.erase(currentNode);
-        closedList.insert(currentNode);
-
-        static constexpr std::array<std::pair<int, int>, 8> directions =
-        {
-            std::make_pair(1, -1),
-            std::make_pair(1, 1),
-            std::make_pair(-1, 1),
-            std::make_pair(-1, -1),
-            std::make_pair(0, -1),
-            std::make_pair(0, 1),
-            std::make_pair(-1, 0),
-            std::make_pair(1, 0)
-        };
-        for(auto dir : directions)
-        {
-            auto neighborLoc = std::make_pair(currentNode->loc.first + dir.first, currentNode->loc.second + dir.second);
-            
-            if(!validLocIndex(neighborLoc.first) || !validLocIndex(neighborLoc.second))
-                continue;
-            if(avoidObstacles)
-            {
-                auto currentPosObject = at(neighborLoc);
-                if(currentPosObject && currentPosObject != startLocObject && currentPosObject != moveLocUnit) continue;
-            }
-            std::size_t index = convertLocationToIndex(neighborLoc);
-            PathNode* neighbourNode;
-            if(!nodes[index]) neighbourNode = initializeNode(neighborLoc);
-            else neighbourNode = nodes[index].get();
-            if(closedList.contains(neighbourNode)) continue;
-
-            int tentativeGCost = currentNode->gCost + calculateDistanceCost(currentNode, neighbourNode);
-            if(tentativeGCost < neighbourNode->gCost)
-            {
-                neighbourNode->parentNode = currentNode;
-                neighbourNode->gCost = tentativeGCost;
-                neighbourNode->hCost = calculateDistanceCost(neighbourNode, endNode);
-                neighbourNode->calculateFCost();
-
-                openList.erase(neighbourNode);//remove when it's already included so it gets correctly sorted position in the set
-                openList.insert(neighbourNode);
-            }
-        }
-    }
-    //no path found
-    return {};
-}
-int GameGrid::moveAlongPath(Path&& path, float speed, bool resetRotationOnEnd)
-{
-    auto startLoc = path.front();
-    auto moveObj = at(startLoc);
-    m_base[convertLocationToIndex(path.back())] = std::move(m_base[convertLocationToIndex(startLoc)]);
-    m_base[convertLocationToIndex(startLoc)].reset();
-    assert(moveObj != nullptr && "There has to be an object to be moved");
-    return moveAlongPath(std::move(path), speed, moveObj, resetRotationOnEnd);
-}
-int GameGrid::moveAlongPath(Path&& path, float speed, GameObject* moveObject, bool resetRotationOnEnd)
+int GameGridView::moveAlongPath(Path path, float speed, GameObject* moveObject, bool resetRotationOnEnd)
 {
+    if(path.empty()) return 0;
+    assert(moveObject != nullptr && "There has to be an object to be moved");
     int pathLength = path.size();
     if(m_movements.empty())
     {
         static GameController& gameControllerInstance = GameController::getInstance();
-        gameControllerInstance.addUpdateFunction(std::bind(&GameGrid::update, this, std::placeholders::_1));
+        m_movementsUpdate = gameControllerInstance.addUpdateFunction(std::bind(&GameGridView::update, this, std::placeholders::_1), "grid movements");
     }
+    moveObject->beginInterpolation();
     m_movements.emplace_back(moveObject, std::move(path), speed, resetRotationOnEnd);
     return pathLength - 1;
 }
-void GameGrid::setSquares(std::set<Loc>&& locations)
+void GameGridView::setSquares(std::set<Loc>&& locations)
 {
     std::unordered_set<std::size_t> indices;
     std::transform(locations.cbegin(), locations.cend(), std::inserter(indices, indices.end()), [](Loc loc) -> std::size_t
@@ -280,160 +131,184 @@ void GameGrid::setSquares(std::set<Loc>&& locations)
     });
     setSquares(std::move(indices));
 }
-void GameGrid::setSquares(std::unordered_set<std::size_t>&& indices)
+void GameGridView::setSquares(const Bitboard& squares)
+{
+    std::unordered_set<std::size_t> indices;
+    squares.forEach([&indices](std::size_t index){indices.insert(index);});
+    setSquares(std::move(indices));
+}
+void GameGridView::setSquares(std::unordered_set<std::size_t>&& indices)
 {
     static UIManager& uiManagerInstance = UIManager::getInstance();
+    const GameGrid& grid = getGrid();
     std::bitset<GRID_SIZE * GRID_SIZE> setSquares {};
     std::bitset<GRID_SIZE * GRID_SIZE / 2> setSquaresLarge {};
-    std::unordered_set<GridObject*> usedObjects;
+    std::unordered_set<const GridCell*> usedObjects;
 
     for(auto index : indices)
     {
-        GridObject* currentObj {};
-        bool indexIsCombined {};
-        for(auto& comb : m_combinedLocations)
-        {
-            if(std::find(comb.first.begin(), comb.first.end(), index) != comb.first.end())
-            {
-                currentObj = comb.second->get();
-                indexIsCombined = true;
-                index = *std::min_element(comb.first.begin(), comb.first.end());
-                break;
-            }
-        }
-        if(!indexIsCombined) currentObj = m_base[index].get();
+        const GridCell* currentObj = grid[index].first;
+        bool indexIsCombined = grid.getLargeMask().test(index);
         if(usedObjects.contains(currentObj)) continue;
         if(currentObj) usedObjects.insert(currentObj);
         if(indexIsCombined)
-            setSquaresLarge.set(index / 2);
+            setSquaresLarge.set(grid.getAnchorIndex(currentObj) / 2);
         else setSquares.set(index);
     }
     uiManagerInstance.setGameGridSquares(std::move(setSquares), std::move(setSquaresLarge));
 }
-void GameGrid::makeSquareNonInteractable(std::size_t index, glm::vec3 color)
+void GameGridView::makeSquareNonInteractable(std::size_t index, glm::vec3 color)
 {
     static UIManager& uiManagerInstance = UIManager::getInstance();
-    for(auto& comb : m_combinedLocations)
+    const GameGrid& grid = getGrid();
+    if(grid.getLargeMask().test(index))
     {
-        if(std::find(comb.first.begin(), comb.first.end(), index) != comb.first.end())
-        {
-            uiManagerInstance.makeLargeGridSquareNonInteractable(*comb.first.begin() / 2, color);
-            return;
-        }
+        uiManagerInstance.makeLargeGridSquareNonInteractable(grid.getAnchorIndex(grid[index].first) / 2, color);
+        return;
     }
     uiManagerInstance.makeGridSquareNonInteractable(index, color);
 }
-std::pair<GridObject*, std::size_t> GameGrid::operator[](std::size_t index) const
-{
-    for(auto& comb : m_combinedLocations)
-    {
-        if(std::find(comb.first.begin(), comb.first.end(), index) != comb.first.end()) return std::make_pair(comb.second->get(), comb.first[0]);
-    }
-    return std::make_pair(m_base[index].get(), index);
-}
-GameGrid::Loc GameGrid::convertIndexToLocation(std::size_t index)
-{
-    return std::make_pair(index % GRID_SIZE, index / GRID_SIZE);
-}
-std::size_t GameGrid::convertLocationToIndex(Loc loc)
-{
-    return loc.first + loc.second * GRID_SIZE;
-}
-glm::vec3 GameGrid::gridLocationToPosition(Loc loc)
+glm::vec3 GameGridView::gridLocationToPosition(Loc loc)
 {
-    return glm::vec3(-1.f + SQUARE_SIZE * loc.first + SQUARE_SIZE / 2.f, 0.f, 
+    return glm::vec3(-1.f + SQUARE_SIZE * loc.first + SQUARE_SIZE / 2.f, 0.f,
         -1.f + SQUARE_SIZE * loc.second + SQUARE_SIZE / 2.f);
 }
-// float GameGrid::distance(Loc loc1, Loc loc2)
-// {
-//     // d = √((|x1−x2|)² + (|y1​−y2|)²)
-//     return std::sqrt(std::pow(std::abs(static_cast<int>(loc1.first) - static_cast<int>(loc2.first)), 2) 
-//         + std::pow(std::abs(static_cast<int>(loc1.second) - static_cast<int>(loc2.second)), 2));
-// }
 
 void Game::activatePlayerSquares()
 {
     static UIManager& uiManagerInstance = UIManager::getInstance();
     uiManagerInstance.setGameGridSquares({});
     std::unordered_set<std::size_t> indices;
-    for(std::size_t i {}; i < m_grid.size(); ++i)
+    m_match.getGameGrid().getTeamMask(m_match.getCurrentTeam()).forEach([&indices](std::size_t index)
     {
-        auto atIndex = m_grid[i].first;
-        if(atIndex && atIndex->getTeam() == (m_playerOneToPlay ? GridObject::Team::playerOne : GridObject::Team::playerTwo))
-            indices.insert(i);
-    }
-    m_grid.setSquares(std::move(indices));
+        indices.insert(index);
+    });
+    m_gridView.setSquares(std::move(indices));
 }
 
-Game::Game() : m_grid(this)
+Game::Game(bool aiOpponent) : m_gridView(this), m_match(this), m_replay(m_match.getSeed())
 {
-    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    if(aiOpponent) m_aiPlayer = std::make_unique<MctsPlayer>();
+    //the objects of the actions, e.g. the missiles, are constructed before the first action needs them
+    GameObjectPool::getInstance();
     static UIManager& uiManagerInstance = UIManager::getInstance();
-    static Random& randomInstance = Random::getInstance();
     uiManagerInstance.disableGameActionButtons(true);
     updateStatusTexts();
-    
-    auto basesRandomSeed = randomInstance.get<std::size_t>(2, (GRID_SIZE - 4) / 2) * 2;
-    m_grid.initializeAt<Base>(0, basesRandomSeed, true);
-    int otherBaseY = (GRID_SIZE - 2) - basesRandomSeed;
-    m_grid.initializeAt<Base>(GRID_SIZE - 2, otherBaseY, false);
-    m_grid.initializeAt<SubmarineUnit>(GRID_SIZE - 3, otherBaseY + 1, false);
 
-    //generate islands
-    std::vector<GameGrid::Loc> validIslandIndices;
-    for(std::size_t x = 2; x < GRID_SIZE - 2; x += 2)//When there are no islands in the same column as the bases and not enough islands to fill a column, it is guaranteed that the path from base to another is not blocked.
-        for(std::size_t y {}; y < GRID_SIZE; y += 2)
-            {
-                if(!m_grid.at(x, y) && !m_grid.at(x + 1, y) && !m_grid.at(x, y + 1) && !m_grid.at(x + 1, y + 1))
-                    validIslandIndices.push_back(std::make_pair(x, y));
-            }
-    static constexpr std::size_t ISLAND_COUNT = 7;
-    static_assert(GRID_SIZE / 2 > ISLAND_COUNT);
-    assert(ISLAND_COUNT <= validIslandIndices.size());
-    for(std::size_t initializedIslands {}; initializedIslands != ISLAND_COUNT; ++initializedIslands)
+    activatePlayerSquares();
+    uiManagerInstance.moveSelection();
+}
+Game::~Game()
+{
+    static GameController& gameControllerInstance = GameController::getInstance();
+    static GameObjectPool& gameObjectPoolInstance = GameObjectPool::getInstance();
+    gameControllerInstance.removeUpdateFunction(m_cooldownUpdate);
+    gameControllerInstance.removeUpdateFunction(m_aiDecisionUpdate);
+    for(Effect& effect : m_effects)
     {
-        auto islandIndex = randomInstance.get<std::size_t>(0, validIslandIndices.size() - 1);
-        m_grid.initializeAt<IslandObject>(validIslandIndices[islandIndex]);
-        validIslandIndices.erase(validIslandIndices.begin() + islandIndex);
+        gameControllerInstance.removeUpdateFunction(effect.update);
+        effect.object->endInterpolation();
+        gameObjectPoolInstance.release(effect.object);
+    }
+}
+void Game::continueFrom(const GameState& state, std::optional<Replay> replay)
+{
+    static UIManager& uiManagerInstance = UIManager::getInstance();
+    //the grid view only sees the objects being replaced, so nothing is animated
+    m_match.setState(state);
+    m_replay = std::move(replay);
+    updateStatusTexts();
+    if(m_match.isGameOver())
+    {
+        const GameGrid& grid = m_match.getGameGrid();
+        endGame((grid.getTeamMask(Team::playerOne) & grid.getLargeMask()).any());
+        return;
+    }
+    if(isAITurn())
+    {
+        uiManagerInstance.setGameGridSquares({});
+        uiManagerInstance.setEndTurnButton(false);
+        requestAIDecision();
+        return;
     }
 
     activatePlayerSquares();
     uiManagerInstance.moveSelection();
 }
-int Game::getMoney() const
+void Game::handleGridEvent(std::function<void()>&& event)
 {
-    return m_playerOneToPlay ? m_playerData.first.money : m_playerData.second.money;
+    if(!m_heldGridEvents.empty()) m_heldGridEvents.back().events.push_back(std::move(event));
+    else event();
 }
-void Game::addMoney(int money)
+void Game::onGridObjectCreated(std::size_t index, UnitTypes type, Team team)
 {
-    if(m_playerOneToPlay) m_playerData.first.money += money;
-    else m_playerData.second.money += money;
-    updateStatusTexts();
+    handleGridEvent([this, index, type, team]()
+    {
+        m_gridView.create(index, type, team);
+    });
 }
-void Game::setTurnData(int maxMoves, int money)
+void Game::onGridObjectDestroyed(std::size_t index)
 {
-    if(m_playerOneToPlay)
+    handleGridEvent([this, index]()
     {
-        m_playerData.first.moves.second = maxMoves;
-        m_playerData.first.turnMoney = money;
-    }
-    else
+        m_gridView.destroy(index);
+    });
+}
+void Game::onGridObjectMoved(const GameGrid::Path& path)
+{
+    handleGridEvent([this, path]()
     {
-        m_playerData.second.moves.second = maxMoves;
-        m_playerData.second.turnMoney = money;
-    }
-    updateStatusTexts();
+        auto moveObject = m_gridView.relocate(GameGrid::convertLocationToIndex(path.front()), GameGrid::convertLocationToIndex(path.back()));
+        m_gridView.moveAlongPath(path, PATH_MOVE_SPEED, moveObject);
+    });
 }
-void Game::takeMove()
+void Game::onGameOver(bool playerOneWins)
 {
-    if(m_playerOneToPlay) --m_playerData.first.moves.first;
-    else --m_playerData.second.moves.first;
-    updateStatusTexts();
+    handleGridEvent([this, playerOneWins]()
+    {
+        endGame(playerOneWins);
+    });
+}
+std::uint32_t Game::holdGridEvents()
+{
+    m_heldGridEvents.push_back({m_nextHold});
+    return m_nextHold++;
+}
+void Game::releaseGridEvents(std::uint32_t hold)
+{
+    auto held = std::find_if(m_heldGridEvents.begin(), m_heldGridEvents.end(), [hold](const HeldGridEvents& other){return other.hold == hold;});
+    assert(held != m_heldGridEvents.end() && "The grid events were already released");
+    auto events = std::move(held->events);
+    m_heldGridEvents.erase(held);
+    for(auto& event : events) event();
+}
+void Game::addEffect(const PooledObject& object, UpdateHandle update)
+{
+    m_effects.push_back({object, update});
+}
+void Game::releaseEffect(PooledObject& object)
+{
+    static GameObjectPool& gameObjectPoolInstance = GameObjectPool::getInstance();
+    auto effect = std::find_if(m_effects.begin(), m_effects.end(), [&object](const Effect& other)
+    {
+        return other.object.prefab == object.prefab && other.object.index == object.index;
+    });
+    assert(effect != m_effects.end() && "The effect was already released");
+    m_effects.erase(effect);
+    gameObjectPoolInstance.release(object);
 }
-bool Game::canMove()
+void Game::recordDecision(const Decision& decision)
 {
-    if(m_playerOneToPlay) return m_playerData.first.moves.first;
-    else return m_playerData.second.moves.first;
+    if(!m_replay) return;
+    m_replay->add(decision);
+    m_replay->save(GameController::LAST_REPLAY_PATH);
+}
+ActionResult Game::useSelectedUnitAction(std::size_t actionIndex, std::optional<GameGrid::Loc> target)
+{
+    assert(m_selectedUnitIndices);
+    auto returnValue = m_match.useAction(m_selectedUnitIndices.value(), actionIndex, target);
+    if(returnValue.used) recordDecision({false, m_selectedUnitIndices.value(), actionIndex, target});
+    return returnValue;
 }
 void Game::endGame(bool playerOneWins)
 {
@@ -444,40 +319,95 @@ void Game::endGame(bool playerOneWins)
 void Game::updateStatusTexts()
 {
     static UIManager& uiManagerInstance = UIManager::getInstance();
-    auto& playerData = m_playerOneToPlay ? m_playerData.first : m_playerData.second;
-    UnitObject* selectedUnit = m_selectedUnitIndices.has_value() ? static_cast<UnitObject*>(m_grid.at(m_selectedUnitIndices.value())) : nullptr;
+    auto& playerData = m_match.getPlayerData(m_match.isPlayerOneToPlay());
+    const GridCell* selectedUnit = m_selectedUnitIndices.has_value() ? m_match.getGameGrid().at(m_selectedUnitIndices.value()) : nullptr;
     uiManagerInstance.updateGameStatusTexts(
         std::format("TURN: {1}{0}MONEY: {2}{3}{0}MOVES: {4}/{5}{0}MONEY PER TURN: {6}\n\n{7}",
         "        ",
-        m_playerOneToPlay ? "PLAYER ONE" : "PLAYER TWO", 
+        m_match.isPlayerOneToPlay() ? "PLAYER ONE" : "PLAYER TWO",
         playerData.money, CURRENCY_SYMBOL,
-        playerData.moves.first, playerData.moves.second,
+        playerData.moves, playerData.maxMoves,
         playerData.turnMoney,
-        selectedUnit ? std::format("SELECTED UNIT HEALTH: {}/{}", selectedUnit->getHealth().first, selectedUnit->getHealth().second) : ""));
+        selectedUnit ? std::format("SELECTED UNIT HEALTH: {}/{}", selectedUnit->health, getUnitDefinition(selectedUnit->type).health) : ""));
 }
 void Game::endTurn()
 {
-    ++m_turnNumber;  
-    if(m_playerOneToPlay) 
+    static UIManager& uiManagerInstance = UIManager::getInstance();
+    bool aiEndedTurn = isAITurn();
+    m_match.endTurn();
+    recordDecision({true});
+    updateStatusTexts();
+    if(isAITurn())
     {
-        m_playerData.first.moves.first = m_playerData.first.moves.second;
-        m_playerData.first.money += m_playerData.first.turnMoney;
+        uiManagerInstance.setGameGridSquares({});
+        uiManagerInstance.setEndTurnButton(false);
+        requestAIDecision();
+        return;
     }
-    else
+
+    activatePlayerSquares();
+    if(aiEndedTurn) uiManagerInstance.setEndTurnButton(true);
+    uiManagerInstance.moveSelection();
+}
+void Game::startCooldown(float cooldown, std::function<void()>&& onEnd)
+{
+    static GameController& gameControllerInstance = GameController::getInstance();
+    m_cooldown = std::make_pair(cooldown, std::move(onEnd));
+    m_cooldownUpdate = gameControllerInstance.addUpdateFunction([&](float deltaTime) -> bool
     {
-        m_playerData.second.moves.first = m_playerData.second.moves.second;
-        m_playerData.second.money += m_playerData.second.turnMoney;
+        auto& cooldownVal = m_cooldown.value();
+        cooldownVal.first -= deltaTime;
+        if(cooldownVal.first <= 0.f)
+        {
+            auto onEnd = std::move(cooldownVal.second);
+            m_cooldown.reset();
+            onEnd();
+            return true;
+        }
+        return false;
+    }, "cooldown", UpdatePriorities::late);
+}
+void Game::requestAIDecision()
+{
+    if(m_gameOver || m_match.isGameOver()) return;
+    static GameController& gameControllerInstance = GameController::getInstance();
+    //the search runs on the AI's own threads while the frames keep rendering
+    m_aiDecision = std::async(std::launch::async, [aiPlayer = m_aiPlayer.get(), match = m_match]()
+    {
+        return aiPlayer->search(match);
+    });
+    m_aiDecisionUpdate = gameControllerInstance.addUpdateFunction([this](float) -> bool
+    {
+        if(m_aiDecision.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+        playAIDecision(m_aiDecision.get());
+        return true;
+    }, "AI decision", UpdatePriorities::late);
+}
+void Game::playAIDecision(const Decision& decision)
+{
+    if(decision.endTurn)
+    {
+        endTurn();
+        return;
     }
-    m_playerOneToPlay = !m_playerOneToPlay;
-    
-    activatePlayerSquares();
+    //the AI uses the actions like a player does, so they are animated the same way
+    m_selectedUnitIndices = decision.unit;
+    Action* action = Action::get(m_match.getGameGrid().at(decision.unit)->type, decision.actionIndex);
+    float cooldown {};
+    if(decision.target) cooldown = static_cast<SelectOnGridAction*>(action)->callback(this, decision.target->first, decision.target->second);
+    else action->use(this);
+    m_selectedUnitIndices.reset();
     updateStatusTexts();
-    static UIManager& uiManagerInstance = UIManager::getInstance();
-    uiManagerInstance.moveSelection();  
+
+    static constexpr float AI_DECISION_DELAY = .4f;
+    startCooldown(cooldown + AI_DECISION_DELAY, [this]()
+    {
+        requestAIDecision();
+    });
 }
 void Game::receiveGameInput(std::size_t index, ButtonTypes buttonType)
 {
-    if(m_gameOver || m_cooldown) return;
+    if(m_gameOver || m_cooldown || isAITurn()) return;
     static UIManager& uiManagerInstance = UIManager::getInstance();
     static SelectSquareCallbackManager& actionCallbackManagerInstance = SelectSquareCallbackManager::getInstance();
     static GameController& gameControllerInstance = GameController::getInstance();
@@ -502,10 +432,10 @@ void Game::receiveGameInput(std::size_t index, ButtonTypes buttonType)
         {
             if(m_selectedActionIndex)
             {
-                UnitObject* selectedUnit = static_cast<UnitObject*>(m_grid.at(m_selectedUnitIndices.value()));
+                UnitObject* selectedUnit = static_cast<UnitObject*>(m_gridView.at(m_selectedUnitIndices.value()));
                 uiManagerInstance.enableGameActionButtons(selectedUnit->getActionData());
                 gameControllerInstance.getCamera()->zoom(selectedUnit->getPosition(), .3f, .5f, 1.f);
-                m_grid.setSquares({m_selectedUnitIndices.value()});
+                m_gridView.setSquares({m_selectedUnitIndices.value()});
                 m_selectedActionIndex.reset();
                 uiManagerInstance.retrieveSavedSelection();
             }
@@ -518,7 +448,7 @@ void Game::receiveGameInput(std::size_t index, ButtonTypes buttonType)
         }
         else
         {
-            UnitObject* selectedUnit = static_cast<UnitObject*>(m_grid.at(m_selectedUnitIndices.value()));
+            UnitObject* selectedUnit = static_cast<UnitObject*>(m_gridView.at(m_selectedUnitIndices.value()));
             m_selectedActionIndex = index - 1;
             auto actionType = selectedUnit->useAction(m_selectedActionIndex.value());
             switch(actionType)
@@ -555,39 +485,25 @@ void Game::receiveGameInput(std::size_t index, ButtonTypes buttonType)
             uiManagerInstance.setGameGridSquares({});
             stopUnitSelection();
 
-            //cooldown
-            m_cooldown = std::make_pair(cooldown, [&]()
+            startCooldown(cooldown, [&]()
             {
                 if(this->m_gameOver) return;
                 activatePlayerSquares();
                 uiManagerInstance.setEndTurnButton(true);
                 uiManagerInstance.retrieveSavedSelection();
             });
-
-            gameControllerInstance.addUpdateFunction([&](float deltaTime) -> bool
-            {
-                auto& cooldownVal = m_cooldown.value();
-                cooldownVal.first -= deltaTime;
-                if(cooldownVal.first <= 0.f)
-                {
-                    cooldownVal.second();
-                    m_cooldown.reset();
-                    return true;
-                }
-                return false;
-            });
         }
         else
         {
             //selected an unit
-            auto atSelectedIndex = m_grid[index];
-            UnitObject* selectedUnit = static_cast<UnitObject*>(atSelectedIndex.first);
+            auto atSelectedIndex = m_match.getGameGrid()[index];
+            UnitObject* selectedUnit = static_cast<UnitObject*>(m_gridView.at(GameGrid::convertIndexToLocation(index)));
             gameControllerInstance.getCamera()->zoom(selectedUnit->getPosition(), .3f, .5f, 1.f);
             uiManagerInstance.saveCurrentSelection();
             m_selectedUnitIndices = GameGrid::convertIndexToLocation(atSelectedIndex.second);
             uiManagerInstance.enableGameActionButtons(selectedUnit->getActionData());
-            m_grid.makeSquareNonInteractable(index, SELECTED_GRID_SQUARE_COLOR);
-            m_grid.setSquares({index});
+            m_gridView.makeSquareNonInteractable(index, SELECTED_GRID_SQUARE_COLOR);
+            m_gridView.setSquares({index});
             uiManagerInstance.setEndTurnButton(false);
         }
         break;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -7,6 +8,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <game/gameController.hpp>
+#include <core/saveFile.hpp>
 #include <engine/renderEngine.hpp>
 #include <engine/shaderManager.hpp>
 #include <engine/shader.hpp>
@@ -15,9 +17,11 @@
 #include <glfwController.hpp>
 #include <game/uiManager.hpp>
 #include <game/game.hpp>
+#include <game/gameObject.hpp>
 #include <assets.hpp>
 #include <game/uiPreset.hpp>
 #include <engine/camera.hpp>
+#include <engine/profiler.hpp>
 
 void inputCallback(int key);
 
@@ -51,34 +55,77 @@ GameController::~GameController() {}
 
 void GameController::update() 
 {
+    ProfileScope scope(ProfileSections::gameController);
     static GLFWController& glfwControllerInstance = GLFWController::getInstance();
-    float deltaTime = glfwControllerInstance.getDeltaTime();
-    auto prev = m_updates.before_begin();
-    for(auto it = m_updates.begin(); it != m_updates.end();) 
+    static Profiler& profilerInstance = Profiler::getInstance();
+    m_updates.setTimingEnabled(profilerInstance.isEnabled());
+    advanceSimulation(std::min(glfwControllerInstance.getDeltaTime(), MAX_FRAME_TIME) * m_timeScale);
+    float ratio = m_stepTime / SIMULATION_STEP;
+    for(GameObject* object : m_interpolatedObjects) object->interpolate(ratio);
+    //the running animations need the next frame
+    if(!m_updates.empty()) glfwControllerInstance.requestRedraw();
+}
+void GameController::advanceSimulation(float time)
+{
+    for(m_stepTime += time; m_stepTime >= SIMULATION_STEP; m_stepTime -= SIMULATION_STEP)
     {
-        if((*it)(deltaTime))
-            it = m_updates.erase_after(prev);
-        else
-        {
-            ++it;
-            ++prev;
-        }
+        for(GameObject* object : m_interpolatedObjects) object->storePreviousTransform();
+        m_updates.run(SIMULATION_STEP);
     }
 }
-void GameController::addUpdateFunction(std::function<bool(float)>&& func)
+UpdateHandle GameController::addUpdateFunction(UpdateFunction&& func, std::string_view name, UpdatePriorities priority)
+{
+    return m_updates.add(std::move(func), name, priority);
+}
+void GameController::removeUpdateFunction(UpdateHandle handle)
+{
+    m_updates.remove(handle);
+}
+void GameController::addInterpolatedObject(GameObject* object)
+{
+    m_interpolatedObjects.push_back(object);
+}
+void GameController::removeInterpolatedObject(GameObject* object)
 {
-    m_updates.push_front(std::move(func));
+    std::erase(m_interpolatedObjects, object);
 }
-void GameController::createGame()
+void GameController::createGame(bool aiOpponent)
 {
     m_hasGame = true;
-    m_currentGame = std::make_unique<Game>();
+    m_currentGame = std::make_unique<Game>(aiOpponent);
+    if(m_startState)
+    {
+        m_currentGame->continueFrom(m_startState->first, std::move(m_startState->second));
+        m_startState.reset();
+    }
 }
 void GameController::destroyGame()
 {
     m_hasGame = false;
+    if(m_currentGame)
+    {
+        if(const Replay* replay = m_currentGame->getReplay()) replay->save(LAST_REPLAY_PATH);
+        const Match& match = m_currentGame->getMatch();
+        if(!match.isGameOver())
+        {
+            GameState state = match.getState();
+            SaveFile::save(SAVED_GAME_PATH, {&state, 1});
+        }
+    }
     m_currentGame.reset();
 }
+void GameController::setStartReplay(Replay replay, int turn)
+{
+    //fast-forwarded headlessly
+    ReplayPlayer player(replay);
+    player.seekToTurn(std::clamp(turn, 0, player.getTurnCount() - 1));
+    replay.truncate(player.getPosition());
+    m_startState.emplace(player.getState(), std::move(replay));
+}
+void GameController::setStartState(const GameState& state)
+{
+    m_startState.emplace(state, std::nullopt);
+}
 bool GameController::hasGame()
 {
     return m_hasGame;
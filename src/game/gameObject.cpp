@@ -1,39 +1,80 @@
+#include <cassert>
+
 #include <glm/gtc/matrix_transform.hpp>
 
 #include <game/gameObject.hpp>
+#include <game/gameController.hpp>
 
-void GameObject::updateModelMatrix()
+void GameObject::updateModelMatrix(const Transform& transform)
 {
     glm::mat4 model(1.f);
-    model = glm::translate(model, m_transform.position);
-    model *= glm::mat4_cast(m_transform.rotation);
-    model = glm::scale(model, m_transform.scale);
+    model = glm::translate(model, transform.position);
+    model *= glm::mat4_cast(transform.rotation);
+    model = glm::scale(model, transform.scale);
     for(auto& obj : m_objects)
     {
         obj->setModel(model);
     }
     for(auto& light : m_lights)
-        light.first.position = m_transform.position + light.second * m_transform.scale;
+        light.first.position = transform.position + light.second * transform.scale;
 }
 GameObject::~GameObject()
 {
     static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
     auto lighting = renderEngineInstance.getLighting();
-    for(auto& light : m_lights) lighting->removePointLight(&light.first);
+    if(m_visible)
+        for(auto& light : m_lights) lighting->removePointLight(&light.first);
     removeFromRenderEngine();
+    if(m_interpolations)
+    {
+        static GameController& gameControllerInstance = GameController::getInstance();
+        gameControllerInstance.removeInterpolatedObject(this);
+    }
 }
 void GameObject::setPosition(glm::vec3 position)
 {
     m_transform.position = position;
-    updateModelMatrix();
+    if(!m_interpolations) updateModelMatrix(m_transform);
 }
 void GameObject::setRotation(glm::quat rotation)
 {
     m_transform.rotation = rotation;
-    updateModelMatrix();
+    if(!m_interpolations) updateModelMatrix(m_transform);
 }
 void GameObject::setScale(glm::vec3 scale)
 {
     m_transform.scale = scale;
-    updateModelMatrix();
+    if(!m_interpolations) updateModelMatrix(m_transform);
+}
+void GameObject::setVisible(bool visible)
+{
+    static RenderEngine& renderEngineInstance = RenderEngine::getInstance();
+    if(visible == m_visible) return;
+    ObjectEntity::setVisible(visible);
+    auto lighting = renderEngineInstance.getLighting();
+    for(auto& light : m_lights)
+    {
+        if(visible) lighting->addPointLight(&light.first);
+        else lighting->removePointLight(&light.first);
+    }
+}
+void GameObject::beginInterpolation()
+{
+    static GameController& gameControllerInstance = GameController::getInstance();
+    if(m_interpolations++) return;
+    m_previousTransform = m_transform;
+    gameControllerInstance.addInterpolatedObject(this);
+}
+void GameObject::endInterpolation()
+{
+    static GameController& gameControllerInstance = GameController::getInstance();
+    assert(m_interpolations > 0 && "The interpolation has to be begun before it's ended");
+    if(--m_interpolations) return;
+    gameControllerInstance.removeInterpolatedObject(this);
+    updateModelMatrix(m_transform);
+}
+void GameObject::interpolate(float ratio)
+{
+    updateModelMatrix({glm::mix(m_previousTransform.position, m_transform.position, ratio),
+        glm::slerp(m_previousTransform.rotation, m_transform.rotation, ratio), glm::mix(m_previousTransform.scale, m_transform.scale, ratio)});
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+#include <glm/glm.hpp>
+
+#include <game/gameObjectPool.hpp>
+#include <engine/object.hpp>
+#include <engine/material.hpp>
+#include <assets.hpp>
+
+GameObjectPool::GameObjectPool()
+{
+    for(std::size_t prefab {}; prefab < PREFABS_COUNT; ++prefab)
+        reserve(static_cast<Prefabs>(prefab), INITIAL_COUNTS[prefab]);
+}
+std::unique_ptr<GameObject> GameObjectPool::createPrefab(Prefabs prefab)
+{
+    switch(prefab)
+    {
+    case Prefabs::missile:
+    {
+        static constexpr Material MISSILE_MAT {glm::vec3(.5f, .7f, .3f), .3f, 180.f, .6f};
+        static constexpr Material MISSILE_STRIPES_MAT {glm::vec3(.9f, .9f, .1f), .6f, 90.f, .2f};
+        return std::make_unique<GameObject>(std::vector<GameObject::GameObjectLight> {},
+            constructObject<LitObject>(MODELS_MISSILE, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, MISSILE_MAT),
+            constructObject<LitObject>(MODELS_MISSILE_STRIPES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, MISSILE_STRIPES_MAT));
+    }
+    default:
+        assert(false && "Unknown prefab");
+        return nullptr;
+    }
+}
+void GameObjectPool::reserve(Prefabs prefab, std::size_t count)
+{
+    Pool& pool = m_pools[static_cast<std::size_t>(prefab)];
+    pool.objects.reserve(count);
+    pool.freeObjects.reserve(count);
+    while(pool.objects.size() < count)
+    {
+        pool.freeObjects.push_back(static_cast<std::uint32_t>(pool.objects.size()));
+        pool.objects.push_back(createPrefab(prefab));
+        pool.objects.back()->setVisible(false);
+    }
+}
+PooledObject GameObjectPool::acquire(Prefabs prefab)
+{
+    Pool& pool = m_pools[static_cast<std::size_t>(prefab)];
+    if(pool.freeObjects.empty()) reserve(prefab, std::max<std::size_t>(pool.objects.size() * 2, 1));
+    std::uint32_t index {pool.freeObjects.back()};
+    pool.freeObjects.pop_back();
+    GameObject* object {pool.objects[index].get()};
+    object->setVisible(true);
+    return {prefab, index, object};
+}
+void GameObjectPool::release(PooledObject& object)
+{
+    assert(object.isValid() && "The object was already released");
+    Pool& pool = m_pools[static_cast<std::size_t>(object.prefab)];
+    assert(pool.objects[object.index].get() == object.object && "The object isn't from this pool");
+    object.object->setVisible(false);
+    pool.freeObjects.push_back(object.index);
+    object = {};
+}
\ No newline at end of file
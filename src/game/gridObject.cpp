@@ -11,30 +11,18 @@
 #include <game/action.hpp>
 #include <assets.hpp>
 
-void UnitObject::initialize()
+void UnitObject::initialize(UnitTypes type)
 {
-    m_actionData.resize(m_actions.size());
-    assert(m_actions.size() < GAME_ACTION_BUTTONS_MAX_COUNT && "Unit cannot have more actions than there are buttons");//the first button is back button so < instead of <=
-    std::transform(m_actions.begin(), m_actions.end(), m_actionData.begin(), [&](Action* action) -> ActionData
+    const UnitDefinition& definition = getUnitDefinition(type);
+    assert(definition.actionsCount < GAME_ACTION_BUTTONS_MAX_COUNT && "Unit cannot have more actions than there are buttons");//the first button is back button so < instead of <=
+    m_actions.resize(definition.actionsCount);
+    m_actionData.resize(definition.actionsCount);
+    for(std::size_t i {}; i < definition.actionsCount; ++i)
     {
+        m_actions[i] = Action::get(type, i);
         //color is not constant so it's only set it when returning data
-        return {std::string_view(action->getName()), {}, action->getInfoText()};
-    });
-}
-void UnitObject::addHealth(int health)
-{
-    m_health += health;
-    if(m_health > m_maxHealth) m_health = m_maxHealth;
-    if(m_health <= 0) destroy();
-}
-std::pair<int, int> UnitObject::getHealth()
-{
-    return std::make_pair(m_health, m_maxHealth);
-}
-void UnitObject::destroy()
-{
-    onDestroy();
-    m_gameInstance->getGameGrid().destroy(this);
+        m_actionData[i] = {m_actions[i]->getName(), {}, m_actions[i]->getInfoText()};
+    }
 }
 ActionTypes UnitObject::useAction(std::size_t actionIndex)
 {
@@ -49,14 +37,6 @@ const std::vector<ActionData>& UnitObject::getActionData()
     return m_actionData;
 }
 
-//end game
-void BaseInterface::onDestroy()
-{
-    static GameController& gameControllerInstance = GameController::getInstance();
-    if(gameControllerInstance.hasGame())
-        m_gameInstance->endGame(m_team == Team::playerOne ? false : true);
-}
-
 static constexpr Material TEAM_ONE_DEFAULT_MAT {glm::vec3(.1f, .7f, .1f), .2f, 150.f, .5f};
 static constexpr Material TEAM_ONE_SECONDARY_MAT {glm::vec3(.9f, .8f, .1f), .5f, 220.f, .8f};
 static constexpr Material TEAM_TWO_DEFAULT_MAT {glm::vec3(.7f, .1f, .7f), .2f, 150.f, .5f};
@@ -68,120 +48,143 @@ static constexpr Material GRAY_MAT {glm::vec3(.5f, .5f, .5f), .2f, 200.f, .7f};
 static constexpr Material LIGHT_GRAY_MAT {glm::vec3(.6f, .6f, .6f), .4f, 220.f, .8f};
 static constexpr Material SAND_YELLOW_MAT {glm::vec3(.8f, .8f, .7f), .5f, 120.f, .3f};
 
-static constexpr int BUY_UNIT_RADIUS = 5;
-
-#define CONSTRUCT_ISLAND(groundMaterial) constructObject<LitObject>(MODELS_ISLAND, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, SAND_YELLOW_MAT), constructObject<LitObject>(MODELS_ISLAND_GROUND, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, groundMaterial)
-#define BUY_UNITS BuyUnitAction<250, BUY_UNIT_RADIUS, SubmarineUnit>::get(), BuyUnitAction<350, BUY_UNIT_RADIUS, ShipUnit>::get(), BuyUnitAction<450, BUY_UNIT_RADIUS, AircraftCarrierUnit>::get()
+//the merged meshes differ between the types and the teams
+static int getMergedMeshKey(UnitTypes type, Team team)
+{
+    return static_cast<int>(type) * 3 + static_cast<int>(team);
+}
+static int getMergedMeshKey(UnitTypes type, bool playerOne)
+{
+    return getMergedMeshKey(type, playerOne ? Team::playerOne : Team::playerTwo);
+}
+#define CONSTRUCT_MERGED(meshKey, ...) constructMergedObject(meshKey, {__VA_ARGS__}, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL)
+#define ISLAND_PARTS(groundMaterial) MeshPart {MODELS_ISLAND, SAND_YELLOW_MAT}, MeshPart {MODELS_ISLAND_GROUND, groundMaterial}
 #define BASE_LIGHTS std::make_pair(lights::PointLight(glm::vec3(.9f, .1f, .1f), {}, .2f), glm::vec3(.2f, .9f, -.7f)), std::make_pair(lights::PointLight(glm::vec3(.1f, .9f, .1f), {}, .2f), glm::vec3(-.8f, .9f, .6f))
 Base::Base(Game* game, bool playerOne)
-    : BaseInterface(game, playerOne,
-    //actions
-    {BUY_UNITS,
-    BaseUpgradeAction<600, BaseUpgrade1, 3, 250>::get()},
+    : UnitObject(game, UnitTypes::base,
     //lights
     {BASE_LIGHTS},
     //3D object parts
-    CONSTRUCT_ISLAND(GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER_2, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING_ROOF, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_GROUND, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_HUT, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_STORAGES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, LIGHT_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_LIGHT_POLES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT),
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::base, playerOne),
+        ISLAND_PARTS(GRAY_MAT),
+        MeshPart {MODELS_BASE_BARRIER, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BARRIER_2, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_BASE_BUILDING, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BUILDING_ROOF, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_GROUND, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_HUT, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_STORAGES, LIGHT_GRAY_MAT},
+        MeshPart {MODELS_BASE_TANKS, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_LIGHT_POLES, BLACK_MAT}),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT, glm::vec3(.9f, .1f, .1f)),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT_2, glm::vec3(.1f, .9f, .1f))) {}
 
 BaseUpgrade1::BaseUpgrade1(Game* game, bool playerOne)
-    : BaseInterface(game, playerOne,
-    {BUY_UNITS, 
-    BaseUpgradeAction<900, BaseUpgrade2, 4, 300>::get()},
+    : UnitObject(game, UnitTypes::baseUpgrade1,
     {BASE_LIGHTS},
-    CONSTRUCT_ISLAND(GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER_2, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING_ROOF, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_GROUND, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_HUT, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_HUT_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_STORAGES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, LIGHT_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_LIGHT_POLES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT),
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::baseUpgrade1, playerOne),
+        ISLAND_PARTS(GRAY_MAT),
+        MeshPart {MODELS_BASE_BARRIER, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BARRIER_2, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_BASE_BUILDING, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BUILDING_ROOF, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_GROUND, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_HUT, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_HUT_2_UPGRADE_1, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_STORAGES, LIGHT_GRAY_MAT},
+        MeshPart {MODELS_BASE_TANKS, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_TANKS_2_UPGRADE_1, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_LIGHT_POLES, BLACK_MAT}),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT, glm::vec3(.9f, .1f, .1f)),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT_2, glm::vec3(.1f, .9f, .1f))) {}
 
 BaseUpgrade2::BaseUpgrade2(Game* game, bool playerOne)
-    : BaseInterface(game, playerOne,
-    {BUY_UNITS},
+    : UnitObject(game, UnitTypes::baseUpgrade2,
     {BASE_LIGHTS},
-    CONSTRUCT_ISLAND(GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BARRIER_2, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_BUILDING_ROOF, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_GROUND, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, DARK_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_HUT, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_HUT_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_STORAGES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, LIGHT_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_STORAGES_2_UPGRADE_2, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, LIGHT_GRAY_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_TANKS_3_UPGRADE_2, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_BASE_LIGHT_POLES, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT),
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::baseUpgrade2, playerOne),
+        ISLAND_PARTS(GRAY_MAT),
+        MeshPart {MODELS_BASE_BARRIER, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BARRIER_2, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_BASE_BUILDING, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_BUILDING_ROOF, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_GROUND, DARK_GRAY_MAT},
+        MeshPart {MODELS_BASE_HUT, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_HUT_2_UPGRADE_1, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_STORAGES, LIGHT_GRAY_MAT},
+        MeshPart {MODELS_BASE_STORAGES_2_UPGRADE_2, LIGHT_GRAY_MAT},
+        MeshPart {MODELS_BASE_TANKS, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_TANKS_2_UPGRADE_1, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_TANKS_3_UPGRADE_2, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_BASE_LIGHT_POLES, BLACK_MAT}),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT, glm::vec3(.9f, .1f, .1f)),
     constructObject<UnlitObject>(MODELS_BASE_LIGHT_2, glm::vec3(.1f, .9f, .1f))) {}
 
-static constexpr int SUBMARINE_MOVE_RADIUS = 5;
-static constexpr int SUBMARINE_HEALTH = 150;
-SubmarineUnit::SubmarineUnit(Game* gameInstance, bool playerOne) 
-    : UnitObject(gameInstance, playerOne,
-    SUBMARINE_HEALTH, 
-    {MoveAction<SUBMARINE_MOVE_RADIUS>::get(), AttackAction<20, 3, 100>::get(), UpgradeAction<350, SubmarineUnitUpgrade1>::get(), SellAction<50>::get()},
-    constructObject<LitObject>(MODELS_SUBMARINE, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_SUBMARINE_SAIL, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT)) {}
+SubmarineUnit::SubmarineUnit(Game* gameInstance, bool playerOne)
+    : UnitObject(gameInstance, UnitTypes::submarine,
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::submarine, playerOne),
+        MeshPart {MODELS_SUBMARINE, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_SUBMARINE_SAIL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT})) {}
 
-SubmarineUnitUpgrade1::SubmarineUnitUpgrade1(Game* gameInstance, bool playerOne) 
-    : UnitObject(gameInstance, playerOne,
-    SUBMARINE_HEALTH, 
-    {MoveAction<SUBMARINE_MOVE_RADIUS + 1>::get(), AttackAction<20, 4, 150>::get(), SellAction<75>::get()},
-    constructObject<LitObject>(MODELS_SUBMARINE, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_SUBMARINE_SAIL, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_SUBMARINE_SAIL_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_SUBMARINE_ANTENNAS_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT)) {}
+SubmarineUnitUpgrade1::SubmarineUnitUpgrade1(Game* gameInstance, bool playerOne)
+    : UnitObject(gameInstance, UnitTypes::submarineUpgrade1,
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::submarineUpgrade1, playerOne),
+        MeshPart {MODELS_SUBMARINE, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_SUBMARINE_SAIL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_SUBMARINE_SAIL_2_UPGRADE_1, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_SUBMARINE_ANTENNAS_UPGRADE_1, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT})) {}
 
-static constexpr int SHIP_MOVE_RADIUS = 3;
-static constexpr int SHIP_HEALTH = 200;
 ShipUnit::ShipUnit(Game* gameInstance, bool playerOne)
-    : UnitObject(gameInstance, playerOne,
-    SHIP_HEALTH, 
-    {MoveAction<SHIP_MOVE_RADIUS>::get(), AttackAction<30, 4, 150>::get(), SellAction<75>::get()},
-    constructObject<LitObject>(MODELS_SHIP, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_SHIP_SAIL, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_SHIP_WEAPONRY, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT)) {}
-
-static constexpr int AIRCRAFT_CARRIER_MOVE_RADIUS = 3;
-static constexpr int AIRCRAFT_CARRIER_HEALTH = 250;
-AircraftCarrierUnit::AircraftCarrierUnit(Game* gameInstance, bool playerOne) 
-    : UnitObject(gameInstance, playerOne,
-    AIRCRAFT_CARRIER_HEALTH,
-    {MoveAction<AIRCRAFT_CARRIER_MOVE_RADIUS, SelectOnGridTypes::cross>::get(), AttackAction<40, 6, 200>::get(), UpgradeAction<500, AircraftCarrierUpgrade1>::get(), SellAction<100>::get()},
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_BRIDGE, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_ANTENNA, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT)) {}
-
-AircraftCarrierUpgrade1::AircraftCarrierUpgrade1(Game* gameInstance, bool playerOne) 
-    : UnitObject(gameInstance, playerOne, 
-    AIRCRAFT_CARRIER_HEALTH,
-    {MoveAction<AIRCRAFT_CARRIER_MOVE_RADIUS + 1, SelectOnGridTypes::cross>::get(), AttackAction<40, 7, 250>::get(), SellAction<125>::get()},
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_BRIDGE, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_ANTENNA, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_BRIDGE_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT),
-    constructObject<LitObject>(MODELS_AIRCRAFT_CARRIER_ANTENNA_2_UPGRADE_1, assets::SHADERS_VBASIC_GLSL, assets::SHADERS_FBASIC_GLSL, BLACK_MAT)) {}
+    : UnitObject(gameInstance, UnitTypes::ship,
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::ship, playerOne),
+        MeshPart {MODELS_SHIP, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_SHIP_SAIL, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_SHIP_WEAPONRY, BLACK_MAT})) {}
+
+AircraftCarrierUnit::AircraftCarrierUnit(Game* gameInstance, bool playerOne)
+    : UnitObject(gameInstance, UnitTypes::aircraftCarrier,
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::aircraftCarrier, playerOne),
+        MeshPart {MODELS_AIRCRAFT_CARRIER, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_BRIDGE, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_ANTENNA, BLACK_MAT})) {}
+
+AircraftCarrierUpgrade1::AircraftCarrierUpgrade1(Game* gameInstance, bool playerOne)
+    : UnitObject(gameInstance, UnitTypes::aircraftCarrierUpgrade1,
+    CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::aircraftCarrierUpgrade1, playerOne),
+        MeshPart {MODELS_AIRCRAFT_CARRIER_UPGRADE_1, playerOne ? TEAM_ONE_DEFAULT_MAT : TEAM_TWO_DEFAULT_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_BRIDGE, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_ANTENNA, BLACK_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_BRIDGE_2_UPGRADE_1, playerOne ? TEAM_ONE_SECONDARY_MAT : TEAM_TWO_SECONDARY_MAT},
+        MeshPart {MODELS_AIRCRAFT_CARRIER_ANTENNA_2_UPGRADE_1, BLACK_MAT})) {}
 
 IslandObject::IslandObject()
-    : NeutralObject(CONSTRUCT_ISLAND(SAND_YELLOW_MAT)) {}
\ No newline at end of file
+    : NeutralObject(CONSTRUCT_MERGED(getMergedMeshKey(UnitTypes::island, Team::neutral), ISLAND_PARTS(SAND_YELLOW_MAT))) {}
+
+std::unique_ptr<GridObject> createGridObject(Game* gameInstance, UnitTypes type, Team team)
+{
+    bool playerOne = team == Team::playerOne;
+    switch(type)
+    {
+        using enum UnitTypes;
+    case island:
+        return std::make_unique<IslandObject>();
+    case base:
+        return std::make_unique<Base>(gameInstance, playerOne);
+    case baseUpgrade1:
+        return std::make_unique<BaseUpgrade1>(gameInstance, playerOne);
+    case baseUpgrade2:
+        return std::make_unique<BaseUpgrade2>(gameInstance, playerOne);
+    case submarine:
+        return std::make_unique<SubmarineUnit>(gameInstance, playerOne);
+    case submarineUpgrade1:
+        return std::make_unique<SubmarineUnitUpgrade1>(gameInstance, playerOne);
+    case ship:
+        return std::make_unique<ShipUnit>(gameInstance, playerOne);
+    case aircraftCarrier:
+        return std::make_unique<AircraftCarrierUnit>(gameInstance, playerOne);
+    case aircraftCarrierUpgrade1:
+        return std::make_unique<AircraftCarrierUpgrade1>(gameInstance, playerOne);
+    default:
+        assert(false && "Unknown grid object type");
+        return nullptr;
+    }
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <format>
 #include <cassert>
+#include <cctype>
 #include <string>
 
 #include <glm/glm.hpp>
@@ -11,6 +12,7 @@
 #include <GLFW/glfw3.h>
 
 #include <engine/renderEngine.hpp>
+#include <engine/profiler.hpp>
 #include <game/uiManager.hpp>
 #include <game/uiPreset.hpp>
 #include <glfwController.hpp>
@@ -23,7 +25,31 @@ UIManager::UIManager()
 {  
     RenderEngine& renderEngineInstance = RenderEngine::getInstance();
     GLFWController& glfwControllerInstance = GLFWController::getInstance();
-    renderEngineInstance.addRenderCallback([this](){m_currentUI->update();});
+    renderEngineInstance.addRenderCallback([this]()
+    {
+        ProfileScope scope(ProfileSections::ui);
+        m_currentUI->update();
+        static Profiler& profilerInstance = Profiler::getInstance();
+        if(profilerInstance.isOverlayEnabled())
+        {
+            static GLFWController& glfwControllerInstance = GLFWController::getInstance();
+            static GameController& gameControllerInstance = GameController::getInstance();
+            FrameTimeStatistics pacing = glfwControllerInstance.getFramePacer().getStatistics();
+            std::string text = profilerInstance.getOverlayText() + std::format("\nPACED FRAMES    P50 {:.2f} P95 {:.2f} P99 {:.2f} JITTER {:.2f}",
+                pacing.p50, pacing.p95, pacing.p99, pacing.jitter);
+            //the update that took the most time since the profiler was enabled
+            const auto& updates = gameControllerInstance.getUpdateScheduler().getStatistics();
+            auto slowest = std::max_element(updates.begin(), updates.end(), [](const auto& a, const auto& b){return a.total < b.total;});
+            if(slowest != updates.end())
+            {
+                std::string name {slowest->name};
+                std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c){return std::toupper(c);});
+                text += std::format("\nSLOWEST UPDATE  {} AVG {:.3f} MAX {:.3f}", name, slowest->total / slowest->runs, slowest->max);
+            }
+            m_profilerText->changeText(std::move(text));
+            m_profilerText->update();
+        }
+    });
 
     constexpr glm::vec3 BUTTON_TEXT_COLOR(.7f, .9f, .9f);
     constexpr glm::vec3 GAME_INFO_TEXT_COLOR(.9f, .9f, .2f);
@@ -49,7 +75,7 @@ UIManager::UIManager()
                 m_gameUI->disableElements(std::move(disable));
             }
             static GameController& gameControllerInstance = GameController::getInstance();
-            gameControllerInstance.createGame();
+            gameControllerInstance.createGame(m_aiOpponentEnabled);
 
         }, ORANGE, 2.6f, BLUE, HIGHLIGHT_THICKNESS);
     
@@ -120,6 +146,15 @@ UIManager::UIManager()
         }, {1.f, .6f, .1f}, 2.1f, BLUE, HIGHLIGHT_THICKNESS);
 
 
+    TextData aiOpponentButtonTextData
+    {
+        .text = "AI OPPONENT (OFF)",
+        .position = {.0f, -.3f},
+        .textColor = BUTTON_TEXT_COLOR
+    };
+    static SettingUIElement aiOpponentButton(std::move(aiOpponentButtonTextData), [](){}, {1.f, .6f, .1f}, 2.1f, BLUE, HIGHLIGHT_THICKNESS,
+        "AI OPPONENT (ON)", &m_aiOpponentEnabled);
+
     TextData infoTextData
     {
         .text = "https://github.com/karjalanp11rakka/naval-conquest",
@@ -139,7 +174,7 @@ UIManager::UIManager()
         for(std::size_t x {}; x < GRID_SIZE; ++x, ++gameElementIndex)
         {
             glm::mat4 squareModel(1.f);
-            squareModel = glm::translate(squareModel, GameGrid::gridLocationToPosition(std::make_pair(x, y)));
+            squareModel = glm::translate(squareModel, GameGridView::gridLocationToPosition(std::make_pair(x, y)));
             squareModel = glm::translate(squareModel, glm::vec3(0.f, .001f, 0.f));
             squareModel = glm::rotate(squareModel, glm::radians(-90.f), glm::vec3(1.f, 0.f, 0.f));
             squareModel = glm::scale(squareModel, glm::vec3(0.9f / GRID_SIZE));
@@ -221,23 +256,25 @@ UIManager::UIManager()
         .scale = 2.8f
     };
     m_gameMiddleText = std::make_unique<TextUIElement>(std::move(gameMiddleTextData));
+    TextData profilerTextData
+    {
+        .position = {-.55f, .55f},
+        .textColor = GAME_INFO_TEXT_COLOR,
+        .scale = .4f
+    };
+    m_profilerText = std::make_unique<TextUIElement>(std::move(profilerTextData));
+    m_profilerText->enable();
     TextData leaveGameTextData
     {
         .text = "LEAVE",
         .position = {.0f, -.5f},
         .textColor = BUTTON_TEXT_COLOR
     };
-    static ButtonUIElement leaveGameButton(std::move(leaveGameTextData), 
-        [this]()
-        {
-            static GameController& gameControllerInstance = GameController::getInstance();
-            gameControllerInstance.destroyGame();
-            this->changeCurrentUI(this->m_menuUI); 
-        }, glm::vec3(.9f, .8f, .4f), 2.f, BLUE, HIGHLIGHT_THICKNESS);
+    static ButtonUIElement leaveGameButton(std::move(leaveGameTextData), [this](){leaveGame();}, glm::vec3(.9f, .8f, .4f), 2.f, BLUE, HIGHLIGHT_THICKNESS);
 
     m_menuUI = std::make_unique<UIPreset>(std::vector<UIElement*>{&playButton, &settingsButton, &infoButton, &exitButton});
     m_currentUI = m_menuUI.get();
-    m_settingsUI = std::make_unique<UIPreset>(std::vector<UIElement*>{&darkBackgroundButton, &fullscreenButton, &backButton});
+    m_settingsUI = std::make_unique<UIPreset>(std::vector<UIElement*>{&darkBackgroundButton, &fullscreenButton, &aiOpponentButton, &backButton});
     m_infoUI = std::make_unique<UIPreset>(std::vector<UIElement*>{m_infoText.get(), &backButton});
     m_gameUI = std::make_unique<UIPreset>(std::move(gameElements));
     m_gameOverUI = std::make_unique<UIPreset>(std::vector<UIElement*>{m_gameMiddleText.get(), &leaveGameButton});
@@ -357,8 +394,25 @@ void UIManager::moveSelection()
 {
     m_currentUI->processInput(GLFW_KEY_RIGHT);
 }
+void UIManager::leaveGame()
+{
+    static GameController& gameControllerInstance = GameController::getInstance();
+    gameControllerInstance.destroyGame();
+    changeCurrentUI(m_menuUI);
+}
 void UIManager::processInput(int key)
 {
+    if(key == GLFW_KEY_F3)
+    {
+        static Profiler& profilerInstance = Profiler::getInstance();
+        profilerInstance.setOverlayEnabled(!profilerInstance.isOverlayEnabled());
+        return;
+    }
+    if(key == GLFW_KEY_ESCAPE && m_currentUI == m_gameUI.get())
+    {
+        leaveGame();
+        return;
+    }
     m_currentUI->processInput(key);
 }
 void UIManager::onWindowResize(int width, int height)
@@ -42,10 +42,7 @@ void drawText(GLTtext* textPtr, const char* text, GLfloat x, GLfloat y, GLfloat
 }
 void InteractableBackground::configureShaders() const 
 {
-    unsigned int colorLoc = glGetUniformLocation(m_shader->getID(), "color");
-    unsigned int modelLoc = glGetUniformLocation(m_shader->getID(), "model");
-
-    glUniform3fv(colorLoc, 1, glm::value_ptr(m_highlightColor));
+    m_colorUniform.set(m_highlightColor);
 
     static GLFWController& glfwControllerInstance = GLFWController::getInstance();
     float windowWidth = glfwControllerInstance.getWidth();
@@ -60,7 +57,7 @@ void InteractableBackground::configureShaders() const
         1.f + m_highlightThickness,
         1.f
     ))};
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(highlightModel));
+    m_modelUniform.set(highlightModel);
 }
 
 void InteractableBackground::draw() const
@@ -2,7 +2,6 @@
 #include <iomanip>
 #include <string>
 #include <sstream>
-#include <thread>
 
 #include <glad/glad.h> // GLAD must be included before GLFW. Even though glfwController.cpp does not directly use GLAD, it is included here for correct initialization order
 #include <GLFW/glfw3.h>
@@ -13,12 +12,29 @@
 
 static constexpr char WINDOW_NAME[] = "Naval Conquest";
 static constexpr int DEFAULT_WINDOW_WIDTH {800}, DEFAULT_WINDOW_HEIGHT {600};
+static constexpr double IDLE_WAIT_TIMEOUT {.5};//in seconds. A frame is rendered at least this often even when idle
 void framebufferSizeCallback(GLFWwindow* window, int width, int height);
 void inputCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+void windowRefreshCallback(GLFWwindow* window);
+void windowFocusCallback(GLFWwindow* window, int focused);
+static bool useHeadlessWindow {};
 
+void GLFWController::setHeadless(bool headless)
+{
+    useHeadlessWindow = headless;
+}
 GLFWController::GLFWController()
 {
-    if(!glfwInit())
+    bool initialized = glfwInit();
+#ifdef GLFW_PLATFORM_NULL
+    //e.g. CI machines without a display or a GPU, where Mesa's llvmpipe renders through OSMesa
+    if(!initialized && useHeadlessWindow)
+    {
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        initialized = glfwInit();
+    }
+#endif
+    if(!initialized)
     {
         const char* description;
         int code = glfwGetError(&description);
@@ -29,6 +45,13 @@ GLFWController::GLFWController()
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    if(useHeadlessWindow)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+#ifdef GLFW_PLATFORM_NULL
+        if(glfwGetPlatform() == GLFW_PLATFORM_NULL) glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
+    }
 
     m_window = glfwCreateWindow(DEFAULT_WINDOW_WIDTH, DEFAULT_WINDOW_HEIGHT, WINDOW_NAME, nullptr, nullptr);
     if(!m_window)
@@ -43,11 +66,13 @@ GLFWController::GLFWController()
     glfwSetFramebufferSizeCallback(m_window, framebufferSizeCallback);  
     glfwSetWindowTitle(m_window, WINDOW_NAME);
     
-    glfwSwapInterval(0);
+    setFramePacing(m_framePacer.getMode());
 
     glfwGetFramebufferSize(m_window, &m_width, &m_height);
 
     glfwSetKeyCallback(m_window, inputCallback);
+    glfwSetWindowRefreshCallback(m_window, windowRefreshCallback);
+    glfwSetWindowFocusCallback(m_window, windowFocusCallback);
 }
 GLFWController::~GLFWController()
 {
@@ -55,23 +80,27 @@ GLFWController::~GLFWController()
 }
 void GLFWController::update()
 {
+    m_deltaTime = m_framePacer.endFrame();
     m_currentTime = glfwGetTime();
-    double deltaTime = m_currentTime - m_lastTime;
-    constexpr float MAX_FRAME_RATE = 1.f / 160.f;
-    if(deltaTime < MAX_FRAME_RATE)
-    {
-        std::this_thread::sleep_for(std::chrono::duration<double>(
-            MAX_FRAME_RATE - deltaTime));
-        m_currentTime = glfwGetTime();
-        deltaTime = m_currentTime - m_lastTime;
-    }
-    m_deltaTime = deltaTime;
-    m_lastTime = m_currentTime;
 
     glfwSwapBuffers(m_window);
-    glfwPollEvents();
+    //the events handled below request the next frame
+    bool idle = m_idleRendering && !m_redrawRequested;
+    m_redrawRequested = false;
+    if(idle)
+    {
+        glfwWaitEventsTimeout(IDLE_WAIT_TIMEOUT);
+        //the time spent waiting isn't passed to the animations the events start
+        m_framePacer.restart();
+    }
+    else glfwPollEvents();
 }
 
+void GLFWController::setFramePacing(FramePacingModes mode, float frameRate)
+{
+    glfwSwapInterval(mode == FramePacingModes::vsync);
+    m_framePacer.setMode(mode, frameRate);
+}
 void GLFWController::maximize()
 {
     glfwMaximizeWindow(m_window);
@@ -98,6 +127,7 @@ void GLFWController::addInputCallback(const std::function<void(int)>& callback)
 void inputCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
     static GLFWController& glfwControllerInstance = GLFWController::getInstance();
+    glfwControllerInstance.requestRedraw();//e.g. the focus of the UI moves
     if(action == GLFW_RELEASE)
     {
         for(auto& func : glfwControllerInstance.m_inputCallbacks)
@@ -110,7 +140,18 @@ void framebufferSizeCallback(GLFWwindow* window, int width, int height)
     glfwControllerInstance.m_width = width;
     glfwControllerInstance.m_height = height;
     glfwControllerInstance.m_isMaximised = glfwGetWindowAttrib(glfwControllerInstance.m_window, GLFW_MAXIMIZED);
+    glfwControllerInstance.requestRedraw();
 
     GameController::getInstance().onWindowResize(width, height);
     RenderEngine::getInstance().onWindowResize(width, height);
+}
+void windowRefreshCallback(GLFWwindow* window)
+{
+    static GLFWController& glfwControllerInstance = GLFWController::getInstance();
+    glfwControllerInstance.requestRedraw();
+}
+void windowFocusCallback(GLFWwindow* window, int focused)
+{
+    static GLFWController& glfwControllerInstance = GLFWController::getInstance();
+    glfwControllerInstance.requestRedraw();
 }
\ No newline at end of file
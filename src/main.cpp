@@ -1,19 +1,105 @@
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+#include <string>
+
+#include <core/replay.hpp>
+#include <core/saveFile.hpp>
 #include <engine/renderEngine.hpp>
+#include <engine/profiler.hpp>
+#include <engine/camera.hpp>
 #include <glfwController.hpp>
 #include <game/gameController.hpp>
 
-int main()
+int main(int argc, char* argv[])
 {
     GLFWController& glfwControllerInstance = GLFWController::getInstance();
     RenderEngine& renderEngineInstance = RenderEngine::getInstance();
     GameController& gameControllerInstance = GameController::getInstance();
+    Profiler& profilerInstance = Profiler::getInstance();
+
+    //--load FILE continues a saved game and --replay FILE [--turn N] a recorded game, e.g. a bug report, from the start of the turn.
+    //--profile shows the frame timings (also toggled with F3) and --trace FILE writes them as a Chrome trace when the game is closed.
+    //--idle renders only when something changes, with a still camera, e.g. to save the battery of a laptop.
+    //--fps N caps the frame rate, 0 removes the cap, and --vsync waits for the display instead.
+    //--speed N runs the animations and the cooldowns N times faster, e.g. to watch a replay quickly
+    std::string_view tracePath;
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string_view argument {argv[i]};
+        if(argument == "--profile")
+        {
+            profilerInstance.setOverlayEnabled(true);
+            continue;
+        }
+        if(argument == "--idle")
+        {
+            glfwControllerInstance.setIdleRendering(true);
+            gameControllerInstance.getCamera()->setOrbiting(false);//the orbit would change every frame
+            continue;
+        }
+        if(argument == "--vsync")
+        {
+            glfwControllerInstance.setFramePacing(FramePacingModes::vsync);
+            continue;
+        }
+        if(i + 1 == argc) break;
+        if(argument == "--fps")
+        {
+            float frameRate = std::atof(argv[++i]);
+            if(frameRate > 0.f) glfwControllerInstance.setFramePacing(FramePacingModes::capped, frameRate);
+            else glfwControllerInstance.setFramePacing(FramePacingModes::uncapped);
+            continue;
+        }
+        if(argument == "--trace")
+        {
+            tracePath = argv[++i];
+            profilerInstance.startTrace();
+            continue;
+        }
+        if(argument == "--speed")
+        {
+            float timeScale = std::atof(argv[++i]);
+            if(timeScale > 0.f) gameControllerInstance.setTimeScale(timeScale);
+            continue;
+        }
+        if(argument == "--load")
+        {
+            auto saveFile = SaveFile::open(argv[++i]);
+            if(!saveFile || saveFile->getStates().empty())
+            {
+                std::cerr << "unable to load the game '" << argv[i] << "'\n";
+                return EXIT_FAILURE;
+            }
+            gameControllerInstance.setStartState(saveFile->getStates().front());
+            continue;
+        }
+        if(argument != "--replay") continue;
+        auto replay = Replay::load(argv[++i]);
+        if(!replay)
+        {
+            std::cerr << "unable to load the replay '" << argv[i] << "'\n";
+            return EXIT_FAILURE;
+        }
+        int turn {};
+        if(i + 2 < argc && std::string_view(argv[i + 1]) == "--turn")
+        {
+            turn = std::atoi(argv[i + 2]);
+            i += 2;
+        }
+        gameControllerInstance.setStartReplay(std::move(*replay), turn);
+    }
 
     while (!glfwControllerInstance.shouldClose())
     {        
+        profilerInstance.beginFrame();
         renderEngineInstance.update();
         gameControllerInstance.update();
         glfwControllerInstance.update();
     }
+    gameControllerInstance.destroyGame();//a game in progress is saved when the window is closed
 
+    if(!tracePath.empty() && !profilerInstance.writeTrace(std::string(tracePath)))
+        std::cerr << "unable to write the trace '" << tracePath << "'\n";
     return 0;
 }
\ No newline at end of file